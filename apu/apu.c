@@ -1,4 +1,5 @@
 #include <stdlib.h>
+#include <limits.h>
 #include "apu.h"
 
 static bool duty_cycles[4][16] = {
@@ -226,8 +227,6 @@ void handle_sample(Apu* apu, u8 cycles) {
 
 #define CLAMP(x, upper, lower) (min(upper, max(x, lower)))
 
-static float prev_sample = 0.0f;
-
 // BUFFER FUNCTIONS
 void write_channels_to_buffer(Apu* apu) {
 	
@@ -240,8 +239,8 @@ void write_channels_to_buffer(Apu* apu) {
 	float sample = ch1_sample + ch2_sample + ch3_sample + ch4_sample;
 		
 	static float beta = 0.5;
-	float filtered = beta * sample + (1 - beta) * prev_sample; // this is a simple low pass filter.
-	prev_sample = filtered;
+	float filtered = beta * sample + (1 - beta) * apu->prev_sample; // this is a simple low pass filter.
+	apu->prev_sample = filtered;
 
 	filtered = CLAMP((filtered * 2), 1.0, 0.0);
 
@@ -283,3 +282,17 @@ void apu_step(Apu* apu, u8 cycles) {
 	}
 }
 
+// Cycles until apu_step, called every 4 cycles, fills the sample buffer. INT_MAX with sound off.
+int apu_next_event(Apu* apu) {
+	long long per_tick = (long long)apu->sample_rate * 4;
+	if (!(apu->nr52 & 0b10000000) || per_tick <= 0) {
+		return INT_MAX;
+	}
+	long long samples = apu->buffer_size - apu->buffer_position;
+	if (samples <= 0) {
+		return 4;
+	}
+	// handle_buffers writes sample n on the first tick that takes sample_counter past n * 4MiB
+	long long ticks = (samples * 1048576 * 4 - apu->sample_counter) / per_tick + 1;
+	return ticks < INT_MAX / 4 ? (int)(ticks * 4) : INT_MAX;
+}
@@ -3,6 +3,7 @@
 
 void init_apu(Apu* apu, int sample_rate, int buffer_size);
 void apu_step(Apu* apu, u8 cycles);
+int apu_next_event(Apu* apu);
 void destroy_apu(Apu* apu);
 float* get_buffer(Apu* apu);
 void trigger_channel(Channel* channel);
@@ -0,0 +1,59 @@
+#pragma once
+
+// Library flavors. Build the whole core, and anything that includes its headers, with one of these
+// defined to get a preset combination of the options below, or define the options one at a time:
+//
+//   YOLAHBOY_FAST      lazy flags, ALU tables, fusion, JIT and AOT; no tracing, profiling or M-cycle
+//                      timing hooks at all
+//   YOLAHBOY_ACCURATE  the plain interpreter with tracing and M-cycle timing, which init_emulator uses by
+//                      default (init_emulator_timed still picks either)
+//   YOLAHBOY_DEBUG     the plain interpreter with tracing, the opcode profiler, the PC sampler and, when the
+//                      debugger frontend is checked out next to the repository, its hooks
+//
+// With none of them it's the plain interpreter with no hooks, as before flavors existed.
+//
+// Options:
+//   ENABLE_LAZY_FLAGS, ENABLE_ALU_TABLES   cpu/alu.h
+//   ENABLE_FUSION, ENABLE_FUSION_PROFILE  cpu/block_cache.h
+//   ENABLE_JIT                            cpu/jit.h
+//   ENABLE_AOT                            cpu/aot.h
+//   ENABLE_TRACE                          cpu/trace.h
+//   ENABLE_MCYCLE_TIMING                  cpu/timing.h
+//   ENABLE_OPCODE_PROFILE                 cpu/profiler.h
+//   ENABLE_PC_SAMPLER                     cpu/sampler.h
+//   ENABLE_DEBUGGER                       breakpoints and the debugger's widgets, which need
+//                                         ../debugger/imgui_custom_widget_wrapper.h
+//   DEFAULT_TIMING                        the TimingMode init_emulator uses, TIMING_INSTRUCTION unless set
+//
+// The structs in global_definitions.h change with the options, so a frontend has to be built with the same
+// ones as the library; core_flavor() says which flavor a library was built as.
+
+#if defined(YOLAHBOY_FAST)
+#define YOLAHBOY_FLAVOR "fast"
+#define ENABLE_LAZY_FLAGS
+#define ENABLE_ALU_TABLES
+#define ENABLE_FUSION
+#define ENABLE_JIT
+#define ENABLE_AOT
+#elif defined(YOLAHBOY_ACCURATE)
+#define YOLAHBOY_FLAVOR "accurate"
+#define ENABLE_TRACE
+#define ENABLE_MCYCLE_TIMING
+#define DEFAULT_TIMING TIMING_MCYCLE
+#elif defined(YOLAHBOY_DEBUG)
+#define YOLAHBOY_FLAVOR "debug"
+#define ENABLE_TRACE
+#define ENABLE_OPCODE_PROFILE
+#define ENABLE_PC_SAMPLER
+#if defined(__has_include)
+#if __has_include("../debugger/imgui_custom_widget_wrapper.h")
+#define ENABLE_DEBUGGER
+#endif
+#endif
+#else
+#define YOLAHBOY_FLAVOR "custom"
+#endif
+
+#ifndef DEFAULT_TIMING
+#define DEFAULT_TIMING TIMING_INSTRUCTION
+#endif
@@ -0,0 +1,346 @@
+#pragma once
+#include "../global_definitions.h"
+#include "operation_definitions.h"
+#include "alu_tables.h"
+
+// ALU core shared by cpu.c and the generated handlers. The flag masks are passed in already built so
+// the generated handlers can bake them in as constants and let the compiler fold the switch away.
+// alu8 reads registers.f as it stands; callers outside this file resolve lazy flags first.
+
+static inline alu_return alu8_compute(Cpu* cpu, u8 x, u8 y, instruction_type type, u8 set_mask, u8 reset_mask, u8 ignore_mask) {
+
+	u8 new_flags = set_mask;
+	u8 result = 0;
+
+	switch (type) {
+	case AND:
+		result = x & y;
+		break;
+	case OR:
+		result = x | y;
+		break;
+	case XOR:
+		result = x ^ y;
+		break;
+	case BIT:
+		result = x & y;
+		break;
+	case CPL:
+		result = ~x;
+		break;
+	case INC:
+	case ADD:
+		result = x + y;
+		if (((x & 0x0f) + (y & 0x0f)) > 0x0f) { //  half carry
+			new_flags |= FLAG_HALFCARRY;
+		}
+		if ((int)x + (int)y > 255) {
+			new_flags |= FLAG_CARRY;
+		}
+		break;
+	case ADC: {
+		u8 carry = ((cpu->registers.f & FLAG_CARRY) ? 1 : 0);
+		if ((x & 0x0f) + (y & 0x0f) + carry > 0x0f) { //  half carry
+			new_flags |= FLAG_HALFCARRY;
+		}
+		if ((int)x + (int)y + carry > 255) {
+			new_flags |= FLAG_CARRY;
+		}
+		result = x + y + carry;
+		break;
+	}
+	case SUB:
+	case CP:
+	case DEC:
+		result = x - y;
+		// new_flags |= FLAG_HALFCARRY | FLAG_CARRY;
+		if ((y & 0x0f) > (x & 0x0f)) { //  half carry (there is a lot of different documentation on this so idk, this matches bgb)
+			new_flags |= FLAG_HALFCARRY;
+		}
+		if ((int)x - (int)y < 0) { //  carry
+			new_flags |= FLAG_CARRY;
+		}
+		break;
+	case SBC: {
+		u8 carry = ((cpu->registers.f & FLAG_CARRY) ? 1 : 0);
+		result = x - y - carry;
+		if (((y & 0x0f)) > ((x & 0x0f) - carry)) { //  half carry (there is a lot of different documentation on this so idk, this matches bgb)
+			new_flags |= FLAG_HALFCARRY;
+		}
+		else {
+			new_flags &= ~FLAG_HALFCARRY;
+		}
+		if ((int)x - (int)y - carry < 0) { //  carry
+			new_flags |= FLAG_CARRY;
+		}
+		else {
+			new_flags &= ~FLAG_CARRY;
+		}
+		break;
+	}
+	case SWAP:
+		result = (x << 4) | (x >> 4);
+		break;
+	case SET_OP:
+		result = x | (1 << y);
+		break;
+	case RL:
+	{
+		u8 new_carry = x & 0b10000000;
+		result = x << 1;
+		result |= ((cpu->registers.f & FLAG_CARRY) >> 4);
+		new_flags |= (new_carry >> 3);
+		break;
+	}
+	case RR:
+	{
+		u8 new_carry = x & 0b00000001;
+		result = x >> 1;
+		result |= ((cpu->registers.f & FLAG_CARRY) << 3);
+		new_flags |= (new_carry << 4);
+		break;
+	}
+	case RES:
+		result = x & ~(1 << y);
+		break;
+	case SLA: {
+		if (x & 0b10000000) new_flags |= FLAG_CARRY;
+		result = x << 1;
+		break;
+	}
+	case SRA: {
+		result = (x >> 1);
+		if (x & 0b10000000) result |= 0b10000000;
+		if (x & 0b00000001) new_flags |= FLAG_CARRY;
+
+		break;
+	}
+	case SRL: {
+		if (x & 0b00000001) new_flags |= FLAG_CARRY;
+		result = x >> 1;
+		break;
+	}
+	case RLC: {
+		result = x << 1;
+		if (x & 0b10000000) {
+			result |= 0b00000001;
+			new_flags |= FLAG_CARRY;
+		}
+		break;
+	}
+	case RRC: {
+		result = x >> 1;
+		if (x & 0b00000001) {
+			result |= 0b10000000;
+			new_flags |= FLAG_CARRY;
+		}
+		break;
+	}
+	case SCF:
+		break;
+	case CCF:
+		if (!(cpu->registers.f & FLAG_CARRY)) {
+			new_flags |= FLAG_CARRY;
+		}
+		break;
+	}
+	if (result == 0) {
+		new_flags |= FLAG_ZERO;
+	}
+
+	new_flags &= ~ignore_mask;
+	new_flags |= ignore_mask & cpu->registers.f;
+	new_flags &= reset_mask;
+	return (alu_return) { result, new_flags };
+}
+
+// Same as alu8_compute, with the carry and half-carry branches of the arithmetic and shift ops replaced by a
+// single load from alu_tables.h. Anything the tables don't cover goes to alu8_compute.
+static inline alu_return alu8_lookup(Cpu* cpu, u8 x, u8 y, instruction_type type, u8 set_mask, u8 reset_mask, u8 ignore_mask) {
+	int carry = (cpu->registers.f & FLAG_CARRY) ? 1 : 0;
+	u16 entry;
+	switch (type) {
+	case INC:
+	case ADD:
+		entry = alu_add_table[0][(x << 8) | y];
+		break;
+	case ADC:
+		entry = alu_add_table[carry][(x << 8) | y];
+		break;
+	case SUB:
+	case CP:
+	case DEC:
+		entry = alu_sub_table[0][(x << 8) | y];
+		break;
+	case SBC:
+		entry = alu_sub_table[carry][(x << 8) | y];
+		break;
+	default: {
+		int shift = alu_shift_index(type);
+		if (shift < 0) {
+			return alu8_compute(cpu, x, y, type, set_mask, reset_mask, ignore_mask);
+		}
+		entry = alu_shift_table[shift][carry][x];
+		break;
+	}
+	}
+
+	u8 new_flags = set_mask | (entry >> 8);
+	new_flags &= ~ignore_mask;
+	new_flags |= ignore_mask & cpu->registers.f;
+	new_flags &= reset_mask;
+	return (alu_return) { (u8)entry, new_flags };
+}
+
+// Table-driven with ENABLE_ALU_TABLES (init_cpu fills the tables), branching otherwise.
+static inline alu_return alu8(Cpu* cpu, u8 x, u8 y, instruction_type type, u8 set_mask, u8 reset_mask, u8 ignore_mask) {
+#ifdef ENABLE_ALU_TABLES
+	return alu8_lookup(cpu, x, y, type, set_mask, reset_mask, ignore_mask);
+#else
+	return alu8_compute(cpu, x, y, type, set_mask, reset_mask, ignore_mask);
+#endif
+}
+
+// Lazy flags, built with ENABLE_LAZY_FLAGS. The generated handlers run 8-bit ops through alu8_update, which
+// keeps the result and records the inputs in cpu->lazy_flags instead of working out Z/N/H/C; most of the time
+// the next op overwrites them unread. Anything that reads F goes through read_flags or zero_flag and
+// anything that writes it outright through write_flags. An op that depends on the old flags (a carry-in, or
+// a flag it leaves alone) resolves the previous op before recording, so only one is ever outstanding and
+// registers.f holds its starting flags. The reference path in cpu.c always computes flags eagerly, and
+// without the tables.
+
+static inline bool reads_carry(instruction_type type) {
+	return type == ADC || type == SBC || type == RL || type == RR || type == CCF;
+}
+
+#ifdef ENABLE_LAZY_FLAGS
+
+static inline void resolve_flags(Cpu* cpu) {
+	LazyFlags* lazy = &cpu->lazy_flags;
+	if (lazy->pending) {
+		lazy->pending = false;
+		cpu->registers.f = alu8(cpu, lazy->x, lazy->y, (instruction_type)lazy->type, lazy->set_mask, lazy->reset_mask, lazy->ignore_mask).flags;
+	}
+}
+
+static inline u8 read_flags(Cpu* cpu) {
+	resolve_flags(cpu);
+	return cpu->registers.f;
+}
+
+// Z alone, without resolving the rest, for JR/JP/CALL/RET Z and NZ.
+static inline u8 zero_flag(Cpu* cpu) {
+	LazyFlags* lazy = &cpu->lazy_flags;
+	if (!lazy->pending) {
+		return cpu->registers.f & FLAG_ZERO;
+	}
+	u8 flags = (lazy->result == 0 ? FLAG_ZERO : 0) | lazy->set_mask;
+	flags = (flags & ~lazy->ignore_mask) | (cpu->registers.f & lazy->ignore_mask);
+	return flags & lazy->reset_mask & FLAG_ZERO;
+}
+
+static inline void write_flags(Cpu* cpu, u8 flags) {
+	cpu->lazy_flags.pending = false;
+	cpu->registers.f = flags;
+}
+
+static inline u8 alu8_update(Cpu* cpu, u8 x, u8 y, instruction_type type, u8 set_mask, u8 reset_mask, u8 ignore_mask) {
+	if ((ignore_mask & 0xF0) == 0xF0) { // SET and RES leave F alone
+		return alu8(cpu, x, y, type, set_mask, reset_mask, ignore_mask).result;
+	}
+	if (ignore_mask != 0 || reads_carry(type)) {
+		resolve_flags(cpu);
+	}
+	LazyFlags* lazy = &cpu->lazy_flags;
+	lazy->pending = true;
+	lazy->type = type;
+	lazy->x = x;
+	lazy->y = y;
+	lazy->set_mask = set_mask;
+	lazy->reset_mask = reset_mask;
+	lazy->ignore_mask = ignore_mask;
+	lazy->result = alu8(cpu, x, y, type, set_mask, reset_mask, ignore_mask).result;
+	return lazy->result;
+}
+
+#else
+
+static inline void resolve_flags(Cpu* cpu) {
+}
+
+static inline u8 read_flags(Cpu* cpu) {
+	return cpu->registers.f;
+}
+
+static inline u8 zero_flag(Cpu* cpu) {
+	return cpu->registers.f & FLAG_ZERO;
+}
+
+static inline void write_flags(Cpu* cpu, u8 flags) {
+	cpu->registers.f = flags;
+}
+
+static inline u8 alu8_update(Cpu* cpu, u8 x, u8 y, instruction_type type, u8 set_mask, u8 reset_mask, u8 ignore_mask) {
+	alu_return ret = alu8(cpu, x, y, type, set_mask, reset_mask, ignore_mask);
+	cpu->registers.f = ret.flags;
+	return ret.result;
+}
+
+#endif
+
+static inline alu16_return alu16(Cpu* cpu, u16 x, u16 y, instruction_type type, address_mode source_addr_mode, u8 set_mask, u8 reset_mask, u8 ignore_mask) {
+	u8 new_flags = set_mask;
+	u16 result = 0;
+	switch (type) {
+	case ADD:
+		result = x + y;
+		if (source_addr_mode == REGISTER16) {
+			if (((x & 0x0FFF) + (y & 0x0FFF)) > 0x0FFF) {
+				new_flags |= FLAG_HALFCARRY;
+			}
+			if ((int)x + (int)y > 0xFFFF) {
+				new_flags |= FLAG_CARRY;
+			}
+		}
+		else {
+			if (((x & 0x0F) + (y & 0x0F)) > 0x0F) {
+				new_flags |= FLAG_HALFCARRY;
+			}
+			if (((x & 0xFF) + (y & 0xFF)) > 0xFF) {
+				new_flags |= FLAG_CARRY;
+			}
+		}
+		break;
+	}
+	if (result == 0) {
+		new_flags |= FLAG_ZERO;
+	}
+	new_flags &= ~ignore_mask;
+	new_flags |= ignore_mask & read_flags(cpu);
+	new_flags &= reset_mask;
+
+	return (alu16_return) { result, new_flags };
+}
+
+static inline void daa(Cpu* cpu) {
+	u8 offset = 0;
+	u8 a = cpu->registers.a;
+	u8 flags = read_flags(cpu);
+	cpu->registers.f = 0;
+	if ((flags & FLAG_HALFCARRY) || (!(flags & FLAG_SUB) && (a & 0xf) > 0x09)) {
+		offset |= 0x06;
+	}
+	if ((flags & FLAG_CARRY) || (!(flags & FLAG_SUB) && (a > 0x99))) {
+		offset |= 0x60;
+		cpu->registers.f |= FLAG_CARRY;
+	}
+
+	if (flags & FLAG_SUB) {
+		cpu->registers.a = a - offset;
+	}
+	else {
+		cpu->registers.a = a + offset;
+	}
+	if (flags & FLAG_SUB) cpu->registers.f |= FLAG_SUB;
+	if (cpu->registers.a == 0) cpu->registers.f |= FLAG_ZERO;
+}
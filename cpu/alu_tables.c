@@ -0,0 +1,51 @@
+#include <string.h>
+#include "alu_tables.h"
+#include "alu.h"
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <pthread.h>
+#define ALU_TABLES_ONCE
+#endif
+
+u16 alu_add_table[2][0x10000];
+u16 alu_sub_table[2][0x10000];
+u16 alu_shift_table[ALU_SHIFT_OPS][2][0x100];
+
+static const instruction_type shift_types[ALU_SHIFT_OPS] = { RLC, RRC, RL, RR, SLA, SRA, SRL, SWAP };
+
+static u16 entry(Cpu* cpu, u8 x, u8 y, instruction_type type) {
+	alu_return ret = alu8_compute(cpu, x, y, type, 0x00, 0xFF, 0x00);
+	return ret.result | (ret.flags << 8);
+}
+
+static void fill_alu_tables(void) {
+	Cpu cpu;
+	memset(&cpu, 0, sizeof(Cpu));
+	for (int carry = 0; carry < 2; ++carry) {
+		cpu.registers.f = carry ? FLAG_CARRY : 0;
+		for (int x = 0; x < 0x100; ++x) {
+			for (int y = 0; y < 0x100; ++y) {
+				alu_add_table[carry][(x << 8) | y] = entry(&cpu, x, y, carry ? ADC : ADD);
+				alu_sub_table[carry][(x << 8) | y] = entry(&cpu, x, y, carry ? SBC : SUB);
+			}
+			for (int i = 0; i < ALU_SHIFT_OPS; ++i) {
+				alu_shift_table[i][carry][x] = entry(&cpu, x, 0, shift_types[i]);
+			}
+		}
+	}
+}
+
+// Fills the tables the first time it's called. Emulators can be created on different threads on Linux and
+// macOS, so it runs through pthread_once there.
+void init_alu_tables() {
+#ifdef ALU_TABLES_ONCE
+	static pthread_once_t once = PTHREAD_ONCE_INIT;
+	pthread_once(&once, fill_alu_tables);
+#else
+	static bool initialized = false;
+	if (!initialized) {
+		fill_alu_tables();
+		initialized = true;
+	}
+#endif
+}
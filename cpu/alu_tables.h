@@ -0,0 +1,30 @@
+#pragma once
+#include "../global_definitions.h"
+#include "operation_definitions.h"
+
+// Lookup tables for the 8-bit arithmetic and CB shift/rotate ops, filled in by init_alu_tables from the
+// branching ALU in alu.h so the two can't disagree. Each entry holds the result in the low byte and the
+// flags the op works out itself (Z, H, C; never the op's SET/RESET/IGNORE masks) in the high byte.
+// alu8 uses them when built with ENABLE_ALU_TABLES; tools/alu_bench.c checks and times both.
+
+#define ALU_SHIFT_OPS 8 // RLC, RRC, RL, RR, SLA, SRA, SRL, SWAP
+
+extern u16 alu_add_table[2][0x10000]; // [carry in][x << 8 | y], ADD/ADC/INC
+extern u16 alu_sub_table[2][0x10000]; // [carry in][x << 8 | y], SUB/SBC/CP/DEC
+extern u16 alu_shift_table[ALU_SHIFT_OPS][2][0x100]; // [op][carry in][x]
+
+void init_alu_tables();
+
+static inline int alu_shift_index(instruction_type type) {
+	switch (type) {
+	case RLC: return 0;
+	case RRC: return 1;
+	case RL: return 2;
+	case RR: return 3;
+	case SLA: return 4;
+	case SRA: return 5;
+	case SRL: return 6;
+	case SWAP: return 7;
+	default: return -1;
+	}
+}
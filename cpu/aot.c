@@ -0,0 +1,130 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "aot.h"
+
+#ifdef AOT_AVAILABLE
+
+#include <dlfcn.h>
+#include "block_cache.h"
+#include "cpu.h"
+#include "native.h"
+#include "../emulator.h"
+#include "../mmu/rom_store.h"
+
+void aot_load(Cartridge* cart) {
+	aot_unload(cart);
+	if (cart->rom == NULL) {
+		return;
+	}
+
+	const char* directory = getenv("YOLAHBOY_AOT_DIR");
+	if (directory == NULL || directory[0] == '\0') { // no default, see aot.h
+		return;
+	}
+	// the store hashes the same rom_size bytes, once per ROM however many emulators load it
+	unsigned long long hash
+		= cart->stored_rom != NULL ? stored_rom_hash(cart->stored_rom) : rom_hash(cart->rom, cart->rom_size);
+	char path[1024];
+	snprintf(path, sizeof(path), "%s/%016llx.so", directory, hash);
+
+	void* handle = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+	if (handle == NULL) {
+		return;
+	}
+	const AotModuleInfo* info = (const AotModuleInfo*)dlsym(handle, "aot_module");
+	if (info == NULL || info->abi_version != AOT_ABI_VERSION || info->emulator_size != sizeof(Emulator) || info->options != AOT_OPTIONS
+		|| info->rom_hash != hash) {
+		dlclose(handle);
+		return;
+	}
+	cart->aot = (Aot*)malloc(sizeof(Aot));
+	if (cart->aot == NULL) {
+		dlclose(handle);
+		return;
+	}
+
+	AotHost host = { fast_handlers, native_tick, native_ticks, native_budget, read8, native_write, sync_flags, leave_bios };
+	info->init(&host);
+	cart->aot->handle = handle;
+	cart->aot->info = info;
+}
+
+void aot_unload(Cartridge* cart) {
+	if (cart->aot == NULL) {
+		return;
+	}
+	dlclose(cart->aot->handle);
+	free(cart->aot);
+	cart->aot = NULL;
+}
+
+static const AotEntry* find_aot_block(const AotModuleInfo* info, u32 key) {
+	int low = 0;
+	int high = info->num_entries - 1;
+	while (low <= high) {
+		int mid = (low + high) / 2;
+		u32 mid_key = info->entries[mid].key;
+		if (mid_key == key) {
+			return &info->entries[mid];
+		}
+		if (mid_key < key) {
+			low = mid + 1;
+		}
+		else {
+			high = mid - 1;
+		}
+	}
+	return NULL;
+}
+
+bool aot_run(Emulator* emu) {
+	Aot* aot = emu->mmu.cartridge.aot;
+	BlockCache* cache = emu->cpu.block_cache;
+	if (aot == NULL || cache == NULL || tracing(emu)) { // traced code goes through the interpreter
+		return false;
+	}
+
+	u16 pc = emu->cpu.registers.pc;
+	if (cache->current != NULL && pc == cache->next_pc) { // partway through an interpreted block
+		return false;
+	}
+	int region_end;
+	int bank = code_bank(emu, pc, &region_end);
+	if (bank < 0 || bank >= BIOS_BANK) {
+		return false;
+	}
+	const AotEntry* entry = find_aot_block(aot->info, ((u32)bank << 16) | pc);
+	if (entry == NULL) {
+		return false;
+	}
+
+	cache->current = NULL;
+	cache->entry_generation = cache->generation;
+	int ran = entry->block(emu, native_budget(emu));
+	if (ran == 0 || (ran < entry->num_ops && cache->generation == cache->entry_generation)) {
+		// too close to the next event, or handed back partway: the interpreter runs the rest of the same block,
+		// cut at the same places, rather than looking up one starting in the middle
+		Block* block = find_block(emu, pc);
+		if (block != NULL && ran < block->num_ops) {
+			enter_block(cache, block);
+			for (; cache->index < ran; ++cache->index) {
+				cache->next_pc += block->ops[cache->index].length;
+			}
+		}
+	}
+	return ran > 0;
+}
+
+#else
+
+void aot_load(Cartridge* cart) {
+}
+
+void aot_unload(Cartridge* cart) {
+}
+
+bool aot_run(Emulator* emu) {
+	return false;
+}
+
+#endif
@@ -0,0 +1,122 @@
+#pragma once
+#include "../global_definitions.h"
+#include "handlers.h"
+#include "../mmu/rom_store.h"
+
+// Ahead-of-time compiled blocks for a specific ROM. tools/aot_compile.c walks the reachable code of every
+// bank and writes C for a shared object with one function per basic block, cut at the same places as the
+// block cache. Loading is opt-in: only when the YOLAHBOY_AOT_DIR environment variable names a directory does
+// load_emu_rom look for <YOLAHBOY_AOT_DIR>/<rom hash>.so, and if it was built for this ROM, these headers and
+// these options, DISPATCH_AOT runs its blocks and falls back to the block cache for anything it doesn't cover
+// (RAM code, bios, code the walk didn't find). Compiled blocks follow the same protocol as the JIT's (see
+// cpu/jit.h): registers live in locals, loads, ALU ops, INC/DEC and JR/JP are inlined with their operands as
+// constants, memory goes through the page tables, and the components are ticked once per block or before a
+// read or write that misses them, inside native_budget. Other instructions call their handler and are
+// ticked one at a time, so results are identical to the interpreter.
+//
+// dlopen runs a module's constructors before any of that is checked, so only point YOLAHBOY_AOT_DIR at
+// modules you built yourself.
+//
+// POSIX only, built with ENABLE_AOT. Without it DISPATCH_AOT behaves like DISPATCH_BLOCK_CACHE.
+
+#if defined(ENABLE_AOT) && (defined(__linux__) || defined(__APPLE__))
+#define AOT_AVAILABLE
+#endif
+
+#define AOT_ABI_VERSION 4
+
+// The build_config.h options a module was compiled with, one bit each; a module only loads into a core
+// built with the same ones.
+#ifdef ENABLE_JIT
+#define AOT_JIT (1u << 0)
+#else
+#define AOT_JIT 0u
+#endif
+#ifdef ENABLE_LAZY_FLAGS
+#define AOT_LAZY_FLAGS (1u << 1)
+#else
+#define AOT_LAZY_FLAGS 0u
+#endif
+#ifdef ENABLE_ALU_TABLES
+#define AOT_ALU_TABLES (1u << 2)
+#else
+#define AOT_ALU_TABLES 0u
+#endif
+#ifdef ENABLE_FUSION
+#define AOT_FUSION (1u << 3)
+#else
+#define AOT_FUSION 0u
+#endif
+#ifdef ENABLE_FUSION_PROFILE
+#define AOT_FUSION_PROFILE (1u << 4)
+#else
+#define AOT_FUSION_PROFILE 0u
+#endif
+#ifdef ENABLE_OPCODE_PROFILE
+#define AOT_OPCODE_PROFILE (1u << 5)
+#else
+#define AOT_OPCODE_PROFILE 0u
+#endif
+#ifdef ENABLE_PC_SAMPLER
+#define AOT_PC_SAMPLER (1u << 6)
+#else
+#define AOT_PC_SAMPLER 0u
+#endif
+#ifdef ENABLE_TRACE
+#define AOT_TRACE (1u << 7)
+#else
+#define AOT_TRACE 0u
+#endif
+#ifdef ENABLE_DEBUGGER
+#define AOT_DEBUGGER (1u << 8)
+#else
+#define AOT_DEBUGGER 0u
+#endif
+#ifdef ENABLE_MCYCLE_TIMING
+#define AOT_MCYCLE_TIMING (1u << 9)
+#else
+#define AOT_MCYCLE_TIMING 0u
+#endif
+#define AOT_OPTIONS (AOT_JIT | AOT_LAZY_FLAGS | AOT_ALU_TABLES | AOT_FUSION | AOT_FUSION_PROFILE \
+	| AOT_OPCODE_PROFILE | AOT_PC_SAMPLER | AOT_TRACE | AOT_DEBUGGER | AOT_MCYCLE_TIMING)
+
+// Called with native_budget; returns how many instructions it ran, 0 if it didn't fit in the budget.
+typedef int (*aot_block)(Emulator* emu, int budget);
+
+typedef struct {
+	u32 key; // (bank << 16) | pc, as in the block cache
+	aot_block block;
+	int num_ops;
+} AotEntry;
+
+// Core functions handed to a module when it's loaded.
+typedef struct {
+	const fast_handler* handlers;
+	bool (*tick)(Emulator* emu, Cycles c, u16 next_pc); // native_tick
+	void (*ticks)(Emulator* emu, const u8* cycles, int count); // native_ticks
+	int (*budget)(Emulator* emu); // native_budget
+	u8 (*read8)(Emulator* emu, u16 address);
+	bool (*write8)(Emulator* emu, u16 address, u8 data); // native_write
+	void (*sync_flags)(Cpu* cpu);
+	void (*leave_bios)(Emulator* emu);
+} AotHost;
+
+// Exported by every module as "aot_module".
+typedef struct {
+	int abi_version;
+	int emulator_size; // sizeof(Emulator) the module was compiled against
+	u32 options; // AOT_OPTIONS the module was compiled with
+	unsigned long long rom_hash;
+	int num_entries;
+	const AotEntry* entries; // sorted by key
+	void (*init)(const AotHost* host);
+} AotModuleInfo;
+
+struct _aot {
+	void* handle;
+	const AotModuleInfo* info;
+};
+
+void aot_load(Cartridge* cart);
+void aot_unload(Cartridge* cart);
+bool aot_run(Emulator* emu);
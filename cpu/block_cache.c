@@ -0,0 +1,264 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "block_cache.h"
+#include "operations.h"
+#include "../mmu/cartridge.h"
+
+BlockCache* create_block_cache() {
+	BlockCache* cache = (BlockCache*)malloc(sizeof(BlockCache));
+	if (cache == NULL) {
+		return NULL;
+	}
+	cache->generation = 0;
+	flush_block_cache(cache);
+#ifdef ENABLE_FUSION_PROFILE
+	memset(cache->fusion_hits, 0, sizeof(cache->fusion_hits));
+#endif
+	return cache;
+}
+
+void destroy_block_cache(BlockCache* cache) {
+	free(cache);
+}
+
+// Needed after anything that changes memory behind write8's back (loading a save state, poking
+// mmu.memory directly from a debugger).
+void flush_block_cache(BlockCache* cache) {
+	for (int i = 0; i < BLOCK_CACHE_SIZE; ++i) {
+		cache->blocks[i].key = NO_BLOCK;
+	}
+	cache->current = NULL;
+	++cache->generation;
+	cache->num_ram_blocks = 0;
+	memset(cache->code_bits, 0, sizeof(cache->code_bits));
+}
+
+static void remove_ram_block(BlockCache* cache, int slot) {
+	for (int i = 0; i < cache->num_ram_blocks; ++i) {
+		if (cache->ram_blocks[i] == slot) {
+			cache->ram_blocks[i] = cache->ram_blocks[--cache->num_ram_blocks];
+			return;
+		}
+	}
+}
+
+static void flush_ram_blocks(BlockCache* cache) {
+	for (int i = 0; i < cache->num_ram_blocks; ++i) {
+		cache->blocks[cache->ram_blocks[i]].key = NO_BLOCK;
+	}
+	cache->num_ram_blocks = 0;
+	cache->current = NULL;
+	++cache->generation;
+	memset(cache->code_bits, 0, sizeof(cache->code_bits));
+}
+
+// Drops every RAM block covering address. The bits for the rest of those blocks stay set; a later write
+// there finds nothing to drop and clears its own bit.
+void invalidate_code(BlockCache* cache, u16 address) {
+	for (int i = 0; i < cache->num_ram_blocks;) {
+		Block* block = &cache->blocks[cache->ram_blocks[i]];
+		if (address >= block->start_pc && address < block->end_pc) {
+			block->key = NO_BLOCK;
+			cache->ram_blocks[i] = cache->ram_blocks[--cache->num_ram_blocks];
+		}
+		else {
+			++i;
+		}
+	}
+	cache->code_bits[address >> 3] &= ~(1 << (address & 7));
+	cache->current = NULL;
+	++cache->generation;
+}
+
+// Bank the code at pc is fetched from, and the end of the region it lives in. -1 if it isn't cacheable.
+int code_bank(Emulator* emu, u16 pc, int* region_end) {
+	if (pc < 0x8000) {
+		if (emu->mmu.in_bios && pc < 0x100) {
+			*region_end = 0x100;
+			return BIOS_BANK;
+		}
+		if (emu->mmu.cartridge.rom == NULL) {
+			return -1;
+		}
+		*region_end = pc < 0x4000 ? 0x4000 : 0x8000;
+		return cart_rom_bank(&emu->mmu.cartridge, pc);
+	}
+	if (pc >= 0xC000 && pc < 0xE000) {
+		*region_end = 0xE000;
+		return RAM_BANK;
+	}
+	if (pc >= 0xFF80 && pc < 0xFFFF) {
+		*region_end = 0xFFFF;
+		return RAM_BANK;
+	}
+	return -1;
+}
+
+#if defined(ENABLE_FUSION) && !defined(ENABLE_OPCODE_PROFILE) // the profiler counts every op on its own
+static bool matches_fusion(const Block* block, int index, const Fusion* fusion) {
+	if (index + fusion->num_ops > block->num_ops) {
+		return false;
+	}
+	for (int i = 0; i < fusion->num_ops; ++i) {
+		if (block->ops[index + i].opcode != fusion->opcodes[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// Marks the first op of each run matching a fusion, taking the first match at each op and going on after it.
+static void mark_fusions(Block* block) {
+	for (int i = 0; i < block->num_ops;) {
+		int matched = 1;
+		for (int f = 0; f < num_fusions && f < MAX_FUSIONS; ++f) {
+			if (matches_fusion(block, i, &fusions[f])) {
+				block->ops[i].fusion = f + 1;
+				matched = fusions[f].num_ops;
+				break;
+			}
+		}
+		i += matched;
+	}
+}
+#endif
+
+static bool decode_block(Emulator* emu, int slot, u32 key, u16 pc, int region_end, bool in_ram) {
+	BlockCache* cache = emu->cpu.block_cache;
+	if (pc + instruction_lengths[fetch8(emu, pc)] > region_end) {
+		return false;
+	}
+
+	Block* block = &cache->blocks[slot];
+	if (block->key != NO_BLOCK && block->in_ram) {
+		remove_ram_block(cache, slot);
+	}
+	if (in_ram && cache->num_ram_blocks == MAX_RAM_BLOCKS) {
+		flush_ram_blocks(cache);
+		map_wram(emu);
+	}
+
+	block->key = key;
+	block->start_pc = pc;
+	block->t_cycles = 0;
+	block->num_ops = 0;
+	block->in_ram = in_ram;
+	block->hits = 0;
+	block->native = NULL;
+
+	int address = pc;
+	while (block->num_ops < MAX_BLOCK_OPS) {
+		u8 opcode = read8(emu, address);
+		u8 length = instruction_lengths[opcode];
+		if (address + length > region_end) {
+			break;
+		}
+
+		MicroOp* uop = &block->ops[block->num_ops++];
+		uop->handler = fast_handlers[opcode];
+		uop->operand = read_operand(emu, address, length);
+		uop->opcode = opcode;
+		uop->length = length;
+		uop->fusion = 0;
+
+		block->t_cycles += operations[opcode].t_cycles;
+		if (operations[opcode].type == CB) {
+			block->t_cycles += cb_operations[uop->operand].t_cycles;
+		}
+		address += length;
+
+		if (ends_block(operations[opcode].type)) {
+			break;
+		}
+	}
+	block->end_pc = address;
+#if defined(ENABLE_FUSION) && !defined(ENABLE_OPCODE_PROFILE)
+	mark_fusions(block);
+#endif
+
+	if (in_ram) {
+		cache->ram_blocks[cache->num_ram_blocks++] = slot;
+		for (int i = block->start_pc; i < address; ++i) {
+			cache->code_bits[i >> 3] |= 1 << (i & 7);
+		}
+		if (block->start_pc < 0xE000) { // writes to its pages have to go through invalidate_code
+			emu->mmu.write_pages[block->start_pc >> 8] = NULL;
+			emu->mmu.write_pages[(address - 1) >> 8] = NULL;
+		}
+	}
+	return true;
+}
+
+Block* find_block(Emulator* emu, u16 pc) {
+	BlockCache* cache = emu->cpu.block_cache;
+	if (cache->rom_load != emu->mmu.rom_loads) { // new cartridge loaded
+		flush_block_cache(cache);
+		map_wram(emu);
+		cache->rom_load = emu->mmu.rom_loads;
+	}
+
+	int region_end;
+	int bank = code_bank(emu, pc, &region_end);
+	if (bank < 0) {
+		return NULL;
+	}
+
+	u32 key = ((u32)bank << 16) | pc;
+	int slot = (pc ^ (bank * 0x61)) & (BLOCK_CACHE_SIZE - 1);
+	if (cache->blocks[slot].key != key && !decode_block(emu, slot, key, pc, region_end, bank == RAM_BANK)) {
+		return NULL;
+	}
+	return &cache->blocks[slot];
+}
+
+// Starts the cursor at the top of block, for callers that already looked it up.
+void enter_block(BlockCache* cache, Block* block) {
+	cache->current = block;
+	cache->index = 0;
+	cache->next_pc = block->start_pc;
+}
+
+// Micro-op for the instruction at PC, or NULL if PC isn't in cacheable memory.
+const MicroOp* next_micro_op(Emulator* emu) {
+	BlockCache* cache = emu->cpu.block_cache;
+	u16 pc = emu->cpu.registers.pc;
+
+	if (cache->current == NULL || pc != cache->next_pc) {
+		cache->current = find_block(emu, pc);
+		cache->index = 0;
+		if (cache->current == NULL) {
+			return NULL;
+		}
+	}
+
+	const MicroOp* uop = &cache->current->ops[cache->index++];
+	if (cache->index == cache->current->num_ops) {
+		cache->current = NULL;
+	}
+	else {
+		cache->next_pc = pc + uop->length;
+	}
+	return uop;
+}
+
+// Hit counts per fusion with ENABLE_FUSION_PROFILE, most frequent first.
+void print_fusion_profile(BlockCache* cache) {
+#ifdef ENABLE_FUSION_PROFILE
+	int order[MAX_FUSIONS];
+	int count = num_fusions < MAX_FUSIONS ? num_fusions : MAX_FUSIONS;
+	for (int i = 0; i < count; ++i) {
+		int j = i;
+		for (; j > 0 && cache->fusion_hits[order[j - 1]] < cache->fusion_hits[i]; --j) {
+			order[j] = order[j - 1];
+		}
+		order[j] = i;
+	}
+	printf("FUSION PROFILE:\n");
+	for (int i = 0; i < count; ++i) {
+		printf("%12llu  %s\n", cache->fusion_hits[order[i]], fusions[order[i]].name);
+	}
+#else
+	printf("Fusion profile not available, build with ENABLE_FUSION_PROFILE\n");
+#endif
+}
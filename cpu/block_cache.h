@@ -0,0 +1,135 @@
+#pragma once
+#include "../global_definitions.h"
+#include "handlers.h"
+#include "cpu.h"
+#include "operation_definitions.h"
+
+// Pre-decoded basic blocks keyed by (bank, PC). A block runs from its entry point to the first jump, call,
+// return, RST, HALT or STOP, or to the edge of its memory region. step() still executes one instruction
+// per call; the cache keeps a cursor into the current block so straight-line code skips the opcode and
+// immediate fetches entirely.
+//
+// ROM blocks stay valid for the life of the cartridge since the bank is part of the key. Blocks decoded
+// from WRAM or HRAM are dropped when any of their bytes are written through write8. Code anywhere else
+// (VRAM, cartridge RAM, echo RAM, OAM, I/O) runs through the uncached decoder.
+
+#define BLOCK_CACHE_SIZE 1024 // must be a power of two
+#define MAX_BLOCK_OPS 16
+#define MAX_RAM_BLOCKS 64
+
+// Block keys are (bank << 16) | pc, with two pseudo banks past the 8-bit ROM bank numbers.
+#define NO_BLOCK 0xFFFFFFFF
+#define BIOS_BANK 0x100
+#define RAM_BANK 0x101
+
+typedef struct {
+	fast_handler handler;
+	u16 operand;
+	u8 opcode;
+	u8 length;
+	u8 fusion; // 1 + index into fusions when this op starts a fused group, 0 otherwise
+} MicroOp;
+
+// Superinstructions, built with ENABLE_FUSION: decode_block marks runs of ops that match one of the common
+// sequences in fusions (generated into handlers.c, see tools/gen_handlers.c), and cpu_step_cached runs the
+// whole run in one step through its fused handler, with the single-op handlers inlined into it. Between ops
+// the group does what step() would (finish_step, ticking the components) minus the dispatch, and it ends
+// early wherever step() would have to do more: an interrupt or EI/DI due, a frame or sample buffer ready, the
+// cursor dropped by a ROM or cached RAM code write, or spin-loop skipping on (it has to see every
+// instruction). ENABLE_FUSION_PROFILE adds per-fusion hit counts, see print_fusion_profile.
+
+#define MAX_FUSED_OPS 3
+#define MAX_FUSIONS 32
+
+typedef Cycles (*fused_handler)(Emulator* emu, const MicroOp* ops);
+
+typedef struct {
+	u8 num_ops;
+	u8 opcodes[MAX_FUSED_OPS];
+	fused_handler handler;
+	const char* name;
+} Fusion;
+
+extern const Fusion fusions[];
+extern const int num_fusions;
+
+typedef struct {
+	u32 key;
+	u16 start_pc;
+	u16 end_pc; // one past the last byte
+	int t_cycles; // base cycles of the whole block, no branches taken
+	u8 num_ops;
+	bool in_ram;
+	u16 hits; // entries so far, drives JIT compilation
+	void* native; // JIT code, NULL until compiled
+	MicroOp ops[MAX_BLOCK_OPS];
+} Block;
+
+struct _block_cache {
+	Block blocks[BLOCK_CACHE_SIZE];
+
+	Block* current; // cursor, NULL when the next instruction needs a lookup
+	int index;
+	u16 next_pc;
+	u32 generation; // bumped whenever a block that is running may have gone stale
+	u32 entry_generation; // generation when the running native block was entered
+
+	u32 rom_load; // mmu.rom_loads the ROM blocks were decoded under
+	u16 ram_blocks[MAX_RAM_BLOCKS]; // slots holding WRAM/HRAM blocks
+	int num_ram_blocks;
+	u8 code_bits[0x2000]; // one bit per address, set for RAM bytes covered by a cached block
+#ifdef ENABLE_FUSION_PROFILE
+	unsigned long long fusion_hits[MAX_FUSIONS];
+#endif
+};
+
+BlockCache* create_block_cache();
+void destroy_block_cache(BlockCache* cache);
+void flush_block_cache(BlockCache* cache);
+const MicroOp* next_micro_op(Emulator* emu);
+Block* find_block(Emulator* emu, u16 pc);
+void enter_block(BlockCache* cache, Block* block);
+void invalidate_code(BlockCache* cache, u16 address);
+int code_bank(Emulator* emu, u16 pc, int* region_end);
+void print_fusion_profile(BlockCache* cache);
+
+// Shared with tools/aot_compile.c so compiled blocks have the same boundaries.
+static inline bool ends_block(instruction_type type) {
+	switch (type) {
+	case JP:
+	case CALL:
+	case RET:
+	case RETI:
+	case RST:
+	case HALT:
+	case STOP:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static inline bool is_cached_code(BlockCache* cache, u16 address) {
+	return cache != NULL && (cache->code_bits[address >> 3] & (1 << (address & 7)));
+}
+
+// Whether any byte of the 256-byte page is covered by a cached block.
+static inline bool page_has_code(BlockCache* cache, u8 page) {
+	if (cache == NULL) {
+		return false;
+	}
+	for (int i = page << 5; i < (page + 1) << 5; ++i) {
+		if (cache->code_bits[i]) {
+			return true;
+		}
+	}
+	return false;
+}
+
+// A bank switch can remap the rest of the block we're in the middle of.
+static inline void drop_block_cursor(BlockCache* cache) {
+	if (cache != NULL) {
+		cache->current = NULL;
+		++cache->generation;
+	}
+}
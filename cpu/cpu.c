@@ -1,8 +1,32 @@
 #include "cpu.h"
+#include "alu.h"
+#include "handlers.h"
+#include "block_cache.h"
+#include "jit.h"
+#include "profiler.h"
+#include "sampler.h"
+#include "trace.h"
+#include "timing.h"
 #include "../controller/controller.h"
 
 void init_cpu(Cpu* cpu) {
 	memset(cpu, 0, sizeof(Cpu));
+#ifdef ENABLE_ALU_TABLES
+	init_alu_tables();
+#endif
+	cpu->block_cache = create_block_cache();
+	cpu->dispatch_mode = cpu->block_cache != NULL ? DISPATCH_BLOCK_CACHE : DISPATCH_THREADED;
+}
+
+void destroy_cpu(Cpu* cpu) {
+	destroy_jit(cpu->jit);
+	cpu->jit = NULL;
+	destroy_block_cache(cpu->block_cache);
+	cpu->block_cache = NULL;
+}
+
+void sync_flags(Cpu* cpu) {
+	resolve_flags(cpu);
 }
 
 void update_IME(Cpu* cpu, bool value) {
@@ -18,7 +42,7 @@ void push(Emulator* emu, u16 value) {
 void pop(Emulator* emu, u16* reg, operand_type operand) {
 	*reg = read16(emu, emu->cpu.registers.sp);
 	if (operand == AF) {
-		emu->cpu.registers.f &= 0xF0;
+		write_flags(&emu->cpu, emu->cpu.registers.f & 0xF0);
 	}
 	emu->cpu.registers.sp += 2;
 }
@@ -78,22 +102,22 @@ u8 generate_ignore_mask(instruction_flags flag_actions) {
 bool condition_passed(Emulator* emu, Operation* op) {
 	switch (op->condition) {
 	case CONDITION_Z:
-		if ((emu->cpu.registers.f & FLAG_ZERO) == FLAG_ZERO) {
+		if (zero_flag(&emu->cpu)) {
 			return true;
 		}
 		break;
 	case CONDITION_NZ:
-		if ((emu->cpu.registers.f & FLAG_ZERO) != FLAG_ZERO) {
+		if (!zero_flag(&emu->cpu)) {
 			return true;
 		}
 		break;
 	case CONDITION_C:
-		if ((emu->cpu.registers.f & FLAG_CARRY) == FLAG_CARRY) {
+		if (read_flags(&emu->cpu) & FLAG_CARRY) {
 			return true;
 		}
 		break;
 	case CONDITION_NC:
-		if ((emu->cpu.registers.f & FLAG_CARRY) != FLAG_CARRY) {
+		if (!(read_flags(&emu->cpu) & FLAG_CARRY)) {
 			return true;
 		}
 		break;
@@ -103,193 +127,17 @@ bool condition_passed(Emulator* emu, Operation* op) {
 	return false;
 }
 
+// The reference path keeps to the branching ALU whatever the build, so ALU tables and lazy flags always have
+// something to be checked against (tools/lockstep.c).
 alu_return run_alu(Cpu* cpu, u8 x, u8 y, instruction_type type, instruction_flags flag_actions) {
-
-	u8 new_flags = generate_set_mask(flag_actions);
-	u8 result = 0;
-
-	switch (type) {
-	case AND:
-		result = x & y;
-		break;
-	case OR:
-		result = x | y;
-		break;
-	case XOR:
-		result = x ^ y;
-		break;
-	case BIT:
-		result = x & y;
-		break;
-	case CPL:
-		result = ~x;
-		break;
-	case INC:
-	case ADD:
-		result = x + y;
-		if (((x & 0x0f) + (y & 0x0f)) > 0x0f) { //  half carry	
-			new_flags |= FLAG_HALFCARRY;
-		}
-		if ((int)x + (int)y > 255) {
-			new_flags |= FLAG_CARRY;
-		}
-		break;
-	case ADC: {
-		u8 carry = ((cpu->registers.f & FLAG_CARRY) ? 1 : 0);
-		if ((x & 0x0f) + (y & 0x0f) + carry > 0x0f) { //  half carry			
-			new_flags |= FLAG_HALFCARRY;
-		}
-		if ((int)x + (int)y + carry > 255) {
-			new_flags |= FLAG_CARRY;
-		}
-		result = x + y + carry;
-		break;
-	}
-	case SUB:
-	case CP:
-	case DEC:
-		result = x - y;
-		// new_flags |= FLAG_HALFCARRY | FLAG_CARRY;
-		if ((y & 0x0f) > (x & 0x0f)) { //  half carry (there is a lot of different documentation on this so idk, this matches bgb) 
-			new_flags |= FLAG_HALFCARRY;
-		}
-		if ((int)x - (int)y < 0) { //  carry
-			new_flags |= FLAG_CARRY;
-		}
-		break;
-	case SBC: {
-		u8 carry = ((cpu->registers.f & FLAG_CARRY) ? 1 : 0);
-		result = x - y - carry;
-		if (((y & 0x0f)) > ((x & 0x0f) - carry)) { //  half carry (there is a lot of different documentation on this so idk, this matches bgb) 
-			new_flags |= FLAG_HALFCARRY;
-		}
-		else {
-			new_flags &= ~FLAG_HALFCARRY;	
-		}
-		if ((int)x - (int)y - carry < 0) { //  carry
-			new_flags |= FLAG_CARRY;
-		}
-		else {
-			new_flags &= ~FLAG_CARRY;
-		}
-		break;
-	}
-	case SWAP:
-		result = (x << 4) | (x >> 4);
-		break;
-	case SET_OP:
-		result = x | (1 << y);
-		break;
-	case RL:
-	{
-		u8 new_carry = x & 0b10000000;
-		result = x << 1;
-		result |= ((cpu->registers.f & FLAG_CARRY) >> 4);
-		new_flags |= (new_carry >> 3);
-		break;
-	}
-	case RR:
-	{
-		u8 new_carry = x & 0b00000001;
-		result = x >> 1;
-		result |= ((cpu->registers.f & FLAG_CARRY) << 3);
-		new_flags |= (new_carry << 4);
-		break;
-	}
-	case RES:
-		result = x & ~(1 << y);
-		break;
-	case SLA: {
-		if (x & 0b10000000) new_flags |= FLAG_CARRY;
-		result = x << 1;
-		break;
-	}
-	case SRA: {
-		result = (x >> 1);
-		if (x & 0b10000000) result |= 0b10000000;
-		if (x & 0b00000001) new_flags |= FLAG_CARRY;
-
-		break;
-	}
-	case SRL: {
-		if (x & 0b00000001) new_flags |= FLAG_CARRY;
-		result = x >> 1;
-		break;
-	}
-	case RLC: {
-		result = x << 1;
-		if (x & 0b10000000) {
-			result |= 0b00000001;
-			new_flags |= FLAG_CARRY;
-		}
-		break;
-	}
-	case RRC: {
-		result = x >> 1;
-		if (x & 0b00000001) {
-			result |= 0b10000000;
-			new_flags |= FLAG_CARRY;
-		}
-		break;
-	}
-	case SCF: 
-		break;
-	case CCF:
-		if (!(cpu->registers.f & FLAG_CARRY)) {
-			new_flags |= FLAG_CARRY;
-		}
-		break;
-	}
-	if (result == 0) {
-		new_flags |= FLAG_ZERO;
-	}
-	u8 ignore_mask = generate_ignore_mask(flag_actions);
-
-	new_flags &= ~ignore_mask;
-	new_flags |= ignore_mask & cpu->registers.f;
-	new_flags &= generate_reset_mask(flag_actions);
-	return (alu_return) { result, new_flags };
+	resolve_flags(cpu);
+	return alu8_compute(cpu, x, y, type, generate_set_mask(flag_actions), generate_reset_mask(flag_actions), generate_ignore_mask(flag_actions));
 }
 
 alu16_return run_alu16(Cpu* cpu, u16 x, u16 y, instruction_type type, address_mode source_addr_mode, instruction_flags flag_actions) {
-	u8 new_flags = 0;
-	new_flags |= generate_set_mask(flag_actions);
-	u16 result;
-	switch (type) {
-	case ADD:
-		result = x + y;
-		if (source_addr_mode == REGISTER16) {
-			if (((x & 0x0FFF) + (y & 0x0FFF)) > 0x0FFF) {
-				new_flags |= FLAG_HALFCARRY;
-			}
-			if ((int)x + (int)y > 0xFFFF) {
-				new_flags |= FLAG_CARRY;
-			}
-		}
-		else {
-			if (((x & 0x0F) + (y & 0x0F)) > 0x0F) {
-				new_flags |= FLAG_HALFCARRY;
-			}
-			if (((x & 0xFF) + (y & 0xFF)) > 0xFF) {
-				new_flags |= FLAG_CARRY;
-			}
-		}
-		break;
-	}
-	if (result == 0) {
-		new_flags |= FLAG_ZERO;
-	}
-	u8 ignore_mask = generate_ignore_mask(flag_actions);
-	new_flags &= ~ignore_mask;
-	new_flags |= ignore_mask & cpu->registers.f;
-	new_flags &= generate_reset_mask(flag_actions);
-
-	return (alu16_return) { result, new_flags };
+	return alu16(cpu, x, y, type, source_addr_mode, generate_set_mask(flag_actions), generate_reset_mask(flag_actions), generate_ignore_mask(flag_actions));
 }
 
-
-
-
 u8* get_reg_from_type(Emulator* emu, operand_type type) {
 	switch (type) {
 	case A:
@@ -344,7 +192,7 @@ u8 get_dest(Emulator* emu, Operation* op) {
 		break;
 	case MEM_READ_ADDR_OFFSET:
 	case MEM_READ:
-		destVal = read8(emu, emu->cpu.registers.pc);
+		destVal = fetch8(emu, emu->cpu.registers.pc);
 		++emu->cpu.registers.pc;
 		break;
 	case OPERAND_NONE:
@@ -383,11 +231,11 @@ void write_dest(Emulator* emu, Operation* op, u8 value) {
 		write8(emu, (0xFF00 + get_dest(emu, op)), value);
 		break;
 	case MEM_READ_ADDR:
-		write8(emu, read16(emu, emu->cpu.registers.pc), value);
+		write8(emu, fetch16(emu, emu->cpu.registers.pc), value);
 		emu->cpu.registers.pc += 2;
 		break;
 	case MEM_READ_ADDR_OFFSET: {
-		u8 offset = read8(emu, emu->cpu.registers.pc);
+		u8 offset = fetch8(emu, emu->cpu.registers.pc);
 		++emu->cpu.registers.pc;
 		write8(emu, (0xFF00 + offset), value);
 		break;
@@ -434,10 +282,10 @@ void run_secondary(Emulator* emu, Operation* op) {
 		*reg -= 1;
 		break;
 	case ADD_T_4:
-		op->t_cycles += 4;
+		emu->cpu.extra_cycles.t_cycles += 4;
 		break;
 	case ADD_T_12:
-		op->t_cycles += 12;
+		emu->cpu.extra_cycles.t_cycles += 12;
 		break;
 	default:
 		return;
@@ -449,7 +297,7 @@ u16 get_source_16(Emulator* emu, Operation* op) {
 	switch (op->source_addr_mode) {
 	case REGISTER16:
 		if (op->source == SP_ADD_I8) {
-			u8 val = read8(emu, emu->cpu.registers.pc++);
+			u8 val = fetch8(emu, emu->cpu.registers.pc++);
 			i8 relative;
 
 			if (val > 127) {
@@ -467,13 +315,13 @@ u16 get_source_16(Emulator* emu, Operation* op) {
 		sourceVal = *get_reg16_from_type(&emu->cpu, op->source);
 		break;
 	case MEM_READ16:
-		sourceVal = read16(emu, emu->cpu.registers.pc);
+		sourceVal = fetch16(emu, emu->cpu.registers.pc);
 		emu->cpu.registers.pc += 2;
 		break;
 	case MEM_READ: {
 		switch (op->source) {
 		case I8: {
-			u8 value = read8(emu, emu->cpu.registers.pc++);
+			u8 value = fetch8(emu, emu->cpu.registers.pc++);
 			i8 relative;
 			if (value > 127) {
 				relative = -(~value + 1);
@@ -508,7 +356,7 @@ u8 get_source(Emulator* emu, Operation* op) {
 		sourceVal = *get_reg_from_type(emu, op->source);
 		break;
 	case MEM_READ:
-		sourceVal = read8(emu, emu->cpu.registers.pc);
+		sourceVal = fetch8(emu, emu->cpu.registers.pc);
 		++emu->cpu.registers.pc;
 		break;
 	case ADDRESS_R16:
@@ -518,11 +366,11 @@ u8 get_source(Emulator* emu, Operation* op) {
 		sourceVal = read8(emu, 0xff00 + *get_reg_from_type(emu, op->source));
 		break;
 	case MEM_READ_ADDR:
-		sourceVal = read8(emu, read16(emu, emu->cpu.registers.pc));
+		sourceVal = read8(emu, fetch16(emu, emu->cpu.registers.pc));
 		emu->cpu.registers.pc += 2;
 		break;
 	case MEM_READ_ADDR_OFFSET:
-		sourceVal = read8(emu, 0xFF00 + read8(emu, emu->cpu.registers.pc++));
+		sourceVal = read8(emu, 0xFF00 + fetch8(emu, emu->cpu.registers.pc++));
 		break;
 	case ADDR_MODE_NONE:
 		sourceVal = op->source;
@@ -535,14 +383,14 @@ u8 get_source(Emulator* emu, Operation* op) {
 
 
 Operation get_operation(Emulator* emu) {
-	u8 opcode = read8(emu, emu->cpu.registers.pc);
+	u8 opcode = fetch8(emu, emu->cpu.registers.pc);
 	Operation ret = operations[opcode];
 	ret.opcode = opcode;
 	return ret;
 }
 
 Operation get_cb_operation(Emulator* emu) {
-	u8 cb_opcode = read8(emu, emu->cpu.registers.pc);
+	u8 cb_opcode = fetch8(emu, emu->cpu.registers.pc);
 	Operation ret = cb_operations[cb_opcode];
 	ret.opcode = cb_opcode;
 	return ret;
@@ -556,7 +404,7 @@ void LD_impl(Emulator* emu, Operation* op) {
 			*get_reg16_from_type(&emu->cpu, op->dest) = source;
 			break;
 		case MEM_READ_ADDR:
-			write16(emu, read16(emu, emu->cpu.registers.pc), source);
+			write16(emu, fetch16(emu, emu->cpu.registers.pc), source);
 			emu->cpu.registers.pc += 2;
 			break;
 		}
@@ -576,6 +424,7 @@ void CALL_impl(Emulator* emu, Operation* op) {
 	if (condition_passed(emu, op)) {
 		push(emu, emu->cpu.registers.pc);
 		jump(emu, addr);
+		sampler_call(emu);
 	}
 	run_secondary(emu, op);
 }
@@ -713,6 +562,7 @@ void ALU_impl(Emulator* emu, Operation* op) {
 }
 
 void PUSH_impl(Emulator* emu, Operation* op) {
+	resolve_flags(&emu->cpu);
 	u16 to_push = get_source_16(emu, op);
 	push(emu, to_push);
 }
@@ -732,6 +582,7 @@ void RL_impl(Emulator* emu, Operation* op) {
 void RET_impl(Emulator* emu, Operation* op) {
 	if (condition_passed(emu, op)) {
 		pop(emu, get_reg16_from_type(&emu->cpu, PC), 0);
+		sampler_return(emu);
 		run_secondary(emu, op);
 	}
 }
@@ -739,29 +590,11 @@ void RET_impl(Emulator* emu, Operation* op) {
 void RST_impl(Emulator* emu, Operation* op) {
 	push(emu, emu->cpu.registers.pc);
 	jump(emu, op->dest);
+	sampler_call(emu);
 }
 
 void DAA_impl(Emulator* emu, Operation* op) {
-	u8 offset = 0;
-	u8 a = emu->cpu.registers.a;
-	u8 flags = emu->cpu.registers.f;
-	emu->cpu.registers.f = 0;
-	if ((flags & FLAG_HALFCARRY) || (!(flags & FLAG_SUB) && (a & 0xf) > 0x09)) {
-		offset |= 0x06;
-	}
-	if ((flags & FLAG_CARRY) || (!(flags & FLAG_SUB) && (a > 0x99))) {
-		offset |= 0x60;
-		emu->cpu.registers.f |= FLAG_CARRY;
-	}
-
-	if (flags & FLAG_SUB) {
-		emu->cpu.registers.a = a - offset;
-	}
-	else {
-		emu->cpu.registers.a = a + offset;
-	}
-	if (flags & FLAG_SUB) emu->cpu.registers.f |= FLAG_SUB;
-	if (emu->cpu.registers.a == 0) emu->cpu.registers.f |= FLAG_ZERO;
+	daa(&emu->cpu);
 }
 
 void CCF_impl(Emulator* emu, Operation* op) {
@@ -771,20 +604,14 @@ void CCF_impl(Emulator* emu, Operation* op) {
 	emu->cpu.registers.f &= (FLAG_CARRY & FLAG_ZERO);
 }
 
-bool should_run_interrupt(Emulator* emu) {
-	u8 j_ret = joypad_return(emu->controller, emu->mmu.memory[0xFF00]);
-	if ((~j_ret & 0b00001111)) emu->mmu.memory[IF] = emu->mmu.memory[IF] | JOYPAD_INTERRUPT;
-	u8 interrupt_flag = emu->mmu.memory[IF];
-	u8 interrupt_enable = emu->mmu.memory[IE];
-	
-	if ((interrupt_flag & interrupt_enable)) {
-		emu->cpu.halted = false;
-		if (emu->cpu.IME) return true;
-		else return false;
-	}
-	else {
+// pending_interrupts is kept up to date as IF, IE and the buttons change (see update_interrupts), so this
+// is a single test on the common path.
+static inline bool should_run_interrupt(Emulator* emu) {
+	if (!emu->cpu.pending_interrupts) {
 		return false;
 	}
+	emu->cpu.halted = false;
+	return emu->cpu.IME;
 }
 
 u16 interrupt_address_from_flag(u8 flag) {
@@ -804,59 +631,173 @@ u16 interrupt_address_from_flag(u8 flag) {
 	}
 }
 
-u16 interrupt_priority(Emulator* emu, u8 interrupt_flag) {
-	for (int i = 0; i < 5; ++i) {
-		u8 itX = interrupt_flag & (1 << i);
-		itX = (read8(emu, IE) & itX);
-		if (itX) {
-			write8(emu, IF, interrupt_flag & ~itX);
-			return interrupt_address_from_flag(itX);
-		}
+// Acknowledges the highest priority pending interrupt (lowest bit) and returns its handler address.
+u16 interrupt_priority(Emulator* emu) {
+	u8 pending = emu->cpu.pending_interrupts & 0b00011111;
+	if (!pending) {
+		return 0;
 	}
-	return 0;
+	u8 itX = pending & -pending;
+	emu->mmu.memory[IF] &= ~itX;
+	update_interrupts(emu);
+	return interrupt_address_from_flag(itX);
 }
 
 void run_interrupt(Emulator* emu) {
-	u16 jump_to = interrupt_priority(emu, read8(emu, IF));
+	u16 jump_to = interrupt_priority(emu);
 	if (jump_to != 0) {
 		
 		emu->cpu.IME = false;
+		trace_interrupt(emu, jump_to);
 		push(emu, emu->cpu.registers.pc);
 		jump(emu, jump_to);
+		sampler_call(emu);
 	}
 }
 
-Cycles cpu_step(Emulator* emu, Operation op) {
-	++emu->cpu.registers.pc;
+// Everything that follows an instruction: pending branch/CB cycles, the EI/DI delay and interrupt dispatch.
+Cycles finish_step(Emulator* emu, Cycles c) {
+	c.m_cycles += emu->cpu.extra_cycles.m_cycles;
+	c.t_cycles += emu->cpu.extra_cycles.t_cycles;
+	emu->cpu.extra_cycles = (Cycles) { 0, 0 };
 
-	if (emu->cpu.registers.pc == 0x101) {
-		emu->mmu.in_bios = false;
+	if (emu->cpu.should_update_IME) {
+		if (emu->cpu.update_IME_counter == 0) {
+			emu->cpu.IME = emu->cpu.update_IME_value;
+			emu->cpu.should_update_IME = false;
+		}
+		else {
+			--emu->cpu.update_IME_counter;
+		}
 	}
 
-	switch (op.type) {
+	if (should_run_interrupt(emu)) {
+		run_interrupt(emu);
+
+		c.m_cycles += 5;
+		c.t_cycles += 20;
+	}
+
+	return c;
+}
+
+// Threaded dispatch: every opcode indexes straight into its generated handler (see handlers.c), which has
+// its operands, flag masks and cycle counts baked in.
+
+Cycles cpu_step_threaded(Emulator* emu) {
+	u16 pc = emu->cpu.registers.pc;
+	u8 opcode = fetch8(emu, pc);
+	u8 length = instruction_lengths[opcode];
+	u16 operand = read_operand(emu, pc, length);
+	trace_instruction(emu, opcode, operand);
+	skip_instruction(emu, length);
+
+	Cycles c = fast_handlers[opcode](emu, operand);
+	profile_op(&emu->cpu, opcode, operand, c);
+	return finish_step(emu, c);
+}
+
+// Same handlers, but fed from the block cache (see block_cache.h). Falls back to decoding in place when PC
+// is somewhere the cache doesn't cover.
+
+Cycles cpu_step_cached(Emulator* emu) {
+	if (emu->cpu.block_cache == NULL) {
+		return cpu_step_threaded(emu);
+	}
+	const MicroOp* uop = next_micro_op(emu);
+	if (uop == NULL) {
+		return cpu_step_threaded(emu);
+	}
+	trace_instruction(emu, uop->opcode, uop->operand);
+	skip_instruction(emu, uop->length);
+#ifdef ENABLE_FUSION
+	if (uop->fusion) {
+#ifdef ENABLE_FUSION_PROFILE
+		++emu->cpu.block_cache->fusion_hits[uop->fusion - 1];
+#endif
+		Cycles c = fusions[uop->fusion - 1].handler(emu, uop);
+		return c.t_cycles ? finish_step(emu, c) : c; // 0 when the group ended on a tick, see continue_fusion
+	}
+#endif
+
+	Cycles c = uop->handler(emu, uop->operand);
+	profile_op(&emu->cpu, uop->opcode, uop->operand, c);
+	return finish_step(emu, c);
+}
+
+#ifdef ENABLE_MCYCLE_TIMING
+// Internal M-cycles before an instruction's first memory access, on top of fetching it.
+static int access_delay(const Operation* op) {
+	switch (op->type) {
+	case PUSH:
+	case CALL:
+	case RST:
+		return 1;
+	case RET:
+		return op->condition != CONDITION_NONE;
+	default:
+		return 0;
+	}
+}
+#endif
+
+// TIMING_MCYCLE dispatch (see timing.h). The components have run for all of the instruction and any
+// interrupt dispatch by the time it returns, so it returns no cycles for step() to tick.
+Cycles cpu_step_timed(Emulator* emu) {
+#ifdef ENABLE_MCYCLE_TIMING
+	u16 pc = emu->cpu.registers.pc;
+	u8 opcode = fetch8(emu, pc);
+	u8 length = instruction_lengths[opcode];
+	u16 operand = read_operand(emu, pc, length);
+	trace_instruction(emu, opcode, operand);
+	skip_instruction(emu, length);
+
+	CycleTiming* timing = &emu->timing;
+	timing->ticked = 0;
+	timing->next_access = 4 * (length + access_delay(&operations[opcode]));
+	timing->in_instruction = true;
+	Cycles c = fast_handlers[opcode](emu, operand);
+	profile_op(&emu->cpu, opcode, operand, c);
+
+	int t_cycles = c.t_cycles + emu->cpu.extra_cycles.t_cycles;
+	tick_until(emu, t_cycles);
+	timing->next_access = t_cycles + 8;
+	c = finish_step(emu, c);
+	tick_until(emu, c.t_cycles);
+	timing->in_instruction = false;
+	return (Cycles) { 0, 0 };
+#else
+	return cpu_step_threaded(emu);
+#endif
+}
+
+// Reference path, selected with DISPATCH_SWITCH.
+
+static void execute_switch(Emulator* emu, Operation* op) {
+	switch (op->type) {
 	case NOP:
 		break;
 	case HALT:
 		emu->cpu.halted = true;
 		break;
 	case LD:
-		LD_impl(emu, &op);
+		LD_impl(emu, op);
 		break;
 
 	case XOR:
-		XOR_impl(emu, &op);
+		XOR_impl(emu, op);
 		break;
 	case INC:
-		INC_impl(emu, &op);
+		INC_impl(emu, op);
 		break;
 	case DEC:
-		DEC_impl(emu, &op);
+		DEC_impl(emu, op);
 		break;
 	case BIT:
-		BIT_impl(emu, &op);
+		BIT_impl(emu, op);
 		break;
 	case CP:
-		CP_impl(emu, &op);
+		CP_impl(emu, op);
 		break;
 
 	case ADD:
@@ -876,50 +817,49 @@ Cycles cpu_step(Emulator* emu, Operation op) {
 	case RRC:
 	case SCF:
 	case CCF:
-		ALU_impl(emu, &op);
+		ALU_impl(emu, op);
 		break;
 	case JP:
-		JP_impl(emu, &op);
+		JP_impl(emu, op);
 		break;
 
 	case CALL:
-		CALL_impl(emu, &op);
+		CALL_impl(emu, op);
 		break;
 	case RET:
-		RET_impl(emu, &op);
+		RET_impl(emu, op);
 		break;
 	case RETI:
-		RET_impl(emu, &op);
+		RET_impl(emu, op);
 		update_IME(&emu->cpu, true);
 		break;
 
 	case RST:
-		RST_impl(emu, &op);
+		RST_impl(emu, op);
 		break;
 
 	case PUSH:
-		PUSH_impl(emu, &op);
+		PUSH_impl(emu, op);
 		break;
 	case POP:
-		POP_impl(emu, &op);
+		POP_impl(emu, op);
 		break;
 
 	case RLA:
 	case RL:
-		RL_impl(emu, &op);
+		RL_impl(emu, op);
 		break;
 
 	case SWAP:
-		SWAP_impl(emu, &op);
+		SWAP_impl(emu, op);
 		break;
 
 	case CB: {
-		Cycles cb_ret = cpu_step(emu, get_cb_operation(emu));
-		if (cb_ret.t_cycles == -1) {
-			return (Cycles) { -1, -1 };
-		}
-		op.m_cycles += cb_ret.m_cycles;
-		op.t_cycles += cb_ret.t_cycles;
+		Operation cb_op = get_cb_operation(emu);
+		advance_pc(emu);
+		execute_switch(emu, &cb_op);
+		emu->cpu.extra_cycles.m_cycles += cb_op.m_cycles;
+		emu->cpu.extra_cycles.t_cycles += cb_op.t_cycles;
 		break;
 	}
 	case EI:
@@ -930,28 +870,23 @@ Cycles cpu_step(Emulator* emu, Operation op) {
 		break;
 
 	case DAA:
-		DAA_impl(emu, &op);
+		DAA_impl(emu, op);
 		break;
 	}
+}
 
-	if (emu->cpu.should_update_IME) {
-		if (emu->cpu.update_IME_counter == 0) {
-			emu->cpu.IME = emu->cpu.update_IME_value;
-			emu->cpu.should_update_IME = false;
-		}
-		else {
-			--emu->cpu.update_IME_counter;
-		}
-	}
-
-	if (should_run_interrupt(emu)) {
-		run_interrupt(emu);
-
-		op.m_cycles += 5;
-		op.t_cycles += 20;
-	}
-
-	return (Cycles) { op.m_cycles, op.t_cycles };
+Cycles cpu_step(Emulator* emu, Operation op) {
+#ifdef ENABLE_OPCODE_PROFILE
+	u16 operand = fetch8(emu, emu->cpu.registers.pc + 1); // CB opcode, if it is one
+#endif
+	trace_at_pc(emu);
+	advance_pc(emu);
+	execute_switch(emu, &op);
+	Cycles c = { op.m_cycles, op.t_cycles };
+#ifdef ENABLE_OPCODE_PROFILE
+	profile_op(&emu->cpu, op.opcode, operand, c);
+#endif
+	return finish_step(emu, c);
 }
 
 Cycles run_halted(Emulator* emu) {
@@ -976,5 +911,8 @@ Cycles run_halted(Emulator* emu) {
 	return cycles;
 }
 
-
-
+// Nothing can interrupt or wake the CPU before some component raises an interrupt: no EI/DI delay counting
+// down and nothing in IF & IE.
+bool interrupts_idle(Emulator* emu) {
+	return !emu->cpu.should_update_IME && !emu->cpu.pending_interrupts;
+}
@@ -3,7 +3,18 @@
 #include "operations.h"
 
 void init_cpu(Cpu* cpu);
+void destroy_cpu(Cpu* cpu);
+void update_IME(Cpu* cpu, bool value);
+void sync_flags(Cpu* cpu); // brings registers.f up to date under ENABLE_LAZY_FLAGS; call before touching F from outside the core
 Cycles cpu_step(Emulator* emu, Operation op);
+Cycles cpu_step_threaded(Emulator* emu);
+Cycles cpu_step_cached(Emulator* emu);
+Cycles cpu_step_timed(Emulator* emu);
+Cycles finish_step(Emulator* emu, Cycles c);
 Operation get_operation(Emulator* emu);
 void print_registers(Cpu* cpu);
 Cycles run_halted(Emulator* emu);
+bool interrupts_idle(Emulator* emu);
+u8 generate_set_mask(instruction_flags flag_actions);
+u8 generate_reset_mask(instruction_flags flag_actions);
+u8 generate_ignore_mask(instruction_flags flag_actions);
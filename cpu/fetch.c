@@ -0,0 +1,49 @@
+#include "fetch.h"
+#include "../mmu/cartridge.h"
+
+static bool map_rom(FetchWindow* window, Cartridge* cart, u16 start, u16 end) {
+	const u8* base = cart_rom_base(cart, start);
+	if (base == NULL) {
+		return false;
+	}
+	window->base = base;
+	window->start = start;
+	window->length = end - start;
+	return true;
+}
+
+// Points the fetch window at the page address is in. Returns false, leaving it empty, if that page isn't
+// plain memory.
+bool map_fetch_window(Emulator* emu, u16 address) {
+	FetchWindow* window = &emu->cpu.fetch;
+	Mmu* mem = &emu->mmu;
+	bool mapped = false;
+
+	window->length = 0;
+	if (address < 0x100 && mem->in_bios) {
+		window->base = mem->bios;
+		window->start = 0;
+		window->length = 0x100;
+		mapped = true;
+	}
+	else if (address < 0x4000) {
+		mapped = map_rom(window, &mem->cartridge, mem->in_bios ? 0x100 : 0, 0x4000);
+	}
+	else if (address < 0x8000) {
+		mapped = map_rom(window, &mem->cartridge, 0x4000, 0x8000);
+	}
+	else if (address >= 0xC000 && address < 0xE000) {
+		window->base = mem->memory + 0xC000;
+		window->start = 0xC000;
+		window->length = 0x2000;
+		mapped = true;
+	}
+	else if (address >= 0xFF80 && address < 0xFFFF) {
+		window->base = mem->memory + 0xFF80;
+		window->start = 0xFF80;
+		window->length = 0x7F;
+		mapped = true;
+	}
+	window->generation = mem->map_generation;
+	return mapped;
+}
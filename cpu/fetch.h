@@ -0,0 +1,26 @@
+#pragma once
+#include "../global_definitions.h"
+#include "../mmu/mmu.h"
+
+// Opcode and immediate fetch through a host pointer to the page PC is in: the bios, ROM bank 0, the
+// switchable ROM bank, WRAM or HRAM. The window is remapped when a fetch falls outside it or when
+// mmu.map_generation moves on (ROM bank or mode writes, a new ROM or bios, leaving the bios), so a fetch
+// is a range check and a load. Code anywhere else goes through read8.
+
+bool map_fetch_window(Emulator* emu, u16 address);
+
+static inline u8 fetch8(Emulator* emu, u16 address) {
+	FetchWindow* window = &emu->cpu.fetch;
+	u16 offset = address - window->start;
+	if (offset >= window->length || window->generation != emu->mmu.map_generation) {
+		if (!map_fetch_window(emu, address)) {
+			return read8(emu, address);
+		}
+		offset = address - window->start;
+	}
+	return window->base[offset];
+}
+
+static inline u16 fetch16(Emulator* emu, u16 address) {
+	return fetch8(emu, address) | (fetch8(emu, address + 1) << 8);
+}
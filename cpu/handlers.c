@@ -0,0 +1,4463 @@
+// Generated by tools/gen_handlers.c from cpu/operations.c. Do not edit by hand.
+
+#include "handlers.h"
+#include "alu.h"
+#include "cpu.h"
+#include "block_cache.h"
+#include "native.h"
+#include "sampler.h"
+
+static Cycles op_00(Emulator* emu, u16 operand) { // NOP
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_01(Emulator* emu, u16 operand) { // LD BC, u16
+	Registers* r = &emu->cpu.registers;
+	u16 src = operand;
+	r->bc = src;
+	return (Cycles) { 3, 12 };
+}
+
+static Cycles op_02(Emulator* emu, u16 operand) { // LD (BC), A
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->a;
+	write8(emu, r->bc, src);
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_03(Emulator* emu, u16 operand) { // INC BC
+	Registers* r = &emu->cpu.registers;
+	++r->bc;
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_04(Emulator* emu, u16 operand) { // INC B
+	Registers* r = &emu->cpu.registers;
+	r->b = alu8_update(&emu->cpu, r->b, 1, INC, 0x00, 0xBF, 0x10);
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_05(Emulator* emu, u16 operand) { // DEC B
+	Registers* r = &emu->cpu.registers;
+	r->b = alu8_update(&emu->cpu, r->b, 1, DEC, 0x40, 0xFF, 0x10);
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_06(Emulator* emu, u16 operand) { // LD B, u8
+	Registers* r = &emu->cpu.registers;
+	u8 src = (u8)operand;
+	r->b = src;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles op_07(Emulator* emu, u16 operand) { // RLCA
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, RLC, 0x00, 0x1F, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_08(Emulator* emu, u16 operand) { // LD (u16), SP
+	Registers* r = &emu->cpu.registers;
+	u16 src = r->sp;
+	write16(emu, operand, src);
+	return (Cycles) { 3, 20 };
+}
+
+static Cycles op_09(Emulator* emu, u16 operand) { // ADD HL, BC
+	Registers* r = &emu->cpu.registers;
+	u16 dst = r->hl;
+	u16 src = r->bc;
+	alu16_return ret = alu16(&emu->cpu, dst, src, ADD, REGISTER16, 0x00, 0xBF, 0x80);
+	r->hl = ret.result;
+	write_flags(&emu->cpu, ret.flags);
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_0A(Emulator* emu, u16 operand) { // LD A, (BC)
+	Registers* r = &emu->cpu.registers;
+	u8 src = read8(emu, r->bc);
+	r->a = src;
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_0B(Emulator* emu, u16 operand) { // DEC BC
+	Registers* r = &emu->cpu.registers;
+	--r->bc;
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_0C(Emulator* emu, u16 operand) { // INC C
+	Registers* r = &emu->cpu.registers;
+	r->c = alu8_update(&emu->cpu, r->c, 1, INC, 0x00, 0xBF, 0x10);
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_0D(Emulator* emu, u16 operand) { // DEC C
+	Registers* r = &emu->cpu.registers;
+	r->c = alu8_update(&emu->cpu, r->c, 1, DEC, 0x40, 0xFF, 0x10);
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_0E(Emulator* emu, u16 operand) { // LD C, u8
+	Registers* r = &emu->cpu.registers;
+	u8 src = (u8)operand;
+	r->c = src;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles op_0F(Emulator* emu, u16 operand) { // RRCA
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, RRC, 0x00, 0x1F, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_10(Emulator* emu, u16 operand) { // STOP
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_11(Emulator* emu, u16 operand) { // LD DE, u16
+	Registers* r = &emu->cpu.registers;
+	u16 src = operand;
+	r->de = src;
+	return (Cycles) { 3, 12 };
+}
+
+static Cycles op_12(Emulator* emu, u16 operand) { // LD (DE), A
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->a;
+	write8(emu, r->de, src);
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_13(Emulator* emu, u16 operand) { // INC DE
+	Registers* r = &emu->cpu.registers;
+	++r->de;
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_14(Emulator* emu, u16 operand) { // INC D
+	Registers* r = &emu->cpu.registers;
+	r->d = alu8_update(&emu->cpu, r->d, 1, INC, 0x00, 0xBF, 0x10);
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_15(Emulator* emu, u16 operand) { // DEC D
+	Registers* r = &emu->cpu.registers;
+	r->d = alu8_update(&emu->cpu, r->d, 1, DEC, 0x40, 0xFF, 0x10);
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_16(Emulator* emu, u16 operand) { // LD D, u8
+	Registers* r = &emu->cpu.registers;
+	u8 src = (u8)operand;
+	r->d = src;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles op_17(Emulator* emu, u16 operand) { // RLA
+	Registers* r = &emu->cpu.registers;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, 0, RL, 0x00, 0x1F, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_18(Emulator* emu, u16 operand) { // JR, i8
+	Registers* r = &emu->cpu.registers;
+	u8 relative = (u8)operand;
+	u16 jump_to = r->pc + (i8)relative;
+	r->pc = jump_to;
+	return (Cycles) { 2, 12 };
+}
+
+static Cycles op_19(Emulator* emu, u16 operand) { // ADD HL, DE
+	Registers* r = &emu->cpu.registers;
+	u16 dst = r->hl;
+	u16 src = r->de;
+	alu16_return ret = alu16(&emu->cpu, dst, src, ADD, REGISTER16, 0x00, 0xBF, 0x80);
+	r->hl = ret.result;
+	write_flags(&emu->cpu, ret.flags);
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_1A(Emulator* emu, u16 operand) { // LD A, (DE)
+	Registers* r = &emu->cpu.registers;
+	u8 src = read8(emu, r->de);
+	r->a = src;
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_1B(Emulator* emu, u16 operand) { // DEC DE
+	Registers* r = &emu->cpu.registers;
+	--r->de;
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_1C(Emulator* emu, u16 operand) { // INC E
+	Registers* r = &emu->cpu.registers;
+	r->e = alu8_update(&emu->cpu, r->e, 1, INC, 0x00, 0xBF, 0x10);
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_1D(Emulator* emu, u16 operand) { // DEC E
+	Registers* r = &emu->cpu.registers;
+	r->e = alu8_update(&emu->cpu, r->e, 1, DEC, 0x40, 0xFF, 0x10);
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_1E(Emulator* emu, u16 operand) { // LD E, u8
+	Registers* r = &emu->cpu.registers;
+	u8 src = (u8)operand;
+	r->e = src;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles op_1F(Emulator* emu, u16 operand) { // RRA
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, RR, 0x00, 0x1F, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_20(Emulator* emu, u16 operand) { // JR NZ, i8
+	Registers* r = &emu->cpu.registers;
+	u8 relative = (u8)operand;
+	u16 jump_to = r->pc + (i8)relative;
+	if (!zero_flag(&emu->cpu)) {
+		r->pc = jump_to;
+		return (Cycles) { 2, 12 };
+	}
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles op_21(Emulator* emu, u16 operand) { // LD HL, u16
+	Registers* r = &emu->cpu.registers;
+	u16 src = operand;
+	r->hl = src;
+	return (Cycles) { 3, 12 };
+}
+
+static Cycles op_22(Emulator* emu, u16 operand) { // LD (HL+), A
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->a;
+	write8(emu, r->hl, src);
+	++r->hl;
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_23(Emulator* emu, u16 operand) { // INC HL
+	Registers* r = &emu->cpu.registers;
+	++r->hl;
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_24(Emulator* emu, u16 operand) { // INC H
+	Registers* r = &emu->cpu.registers;
+	r->h = alu8_update(&emu->cpu, r->h, 1, INC, 0x00, 0xBF, 0x10);
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_25(Emulator* emu, u16 operand) { // DEC H
+	Registers* r = &emu->cpu.registers;
+	r->h = alu8_update(&emu->cpu, r->h, 1, DEC, 0x40, 0xFF, 0x10);
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_26(Emulator* emu, u16 operand) { // LD H, u8
+	Registers* r = &emu->cpu.registers;
+	u8 src = (u8)operand;
+	r->h = src;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles op_27(Emulator* emu, u16 operand) { // DAA
+	daa(&emu->cpu);
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_28(Emulator* emu, u16 operand) { // JR Z, i8
+	Registers* r = &emu->cpu.registers;
+	u8 relative = (u8)operand;
+	u16 jump_to = r->pc + (i8)relative;
+	if (zero_flag(&emu->cpu)) {
+		r->pc = jump_to;
+		return (Cycles) { 2, 12 };
+	}
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles op_29(Emulator* emu, u16 operand) { // ADD HL, HL
+	Registers* r = &emu->cpu.registers;
+	u16 dst = r->hl;
+	u16 src = r->hl;
+	alu16_return ret = alu16(&emu->cpu, dst, src, ADD, REGISTER16, 0x00, 0xBF, 0x80);
+	r->hl = ret.result;
+	write_flags(&emu->cpu, ret.flags);
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_2A(Emulator* emu, u16 operand) { // LD A, (HL+)
+	Registers* r = &emu->cpu.registers;
+	u8 src = read8(emu, r->hl);
+	r->a = src;
+	++r->hl;
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_2B(Emulator* emu, u16 operand) { // DEC HL
+	Registers* r = &emu->cpu.registers;
+	--r->hl;
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_2C(Emulator* emu, u16 operand) { // INC L
+	Registers* r = &emu->cpu.registers;
+	r->l = alu8_update(&emu->cpu, r->l, 1, INC, 0x00, 0xBF, 0x10);
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_2D(Emulator* emu, u16 operand) { // DEC L
+	Registers* r = &emu->cpu.registers;
+	r->l = alu8_update(&emu->cpu, r->l, 1, DEC, 0x40, 0xFF, 0x10);
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_2E(Emulator* emu, u16 operand) { // LD L, u8
+	Registers* r = &emu->cpu.registers;
+	u8 src = (u8)operand;
+	r->l = src;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles op_2F(Emulator* emu, u16 operand) { // CPL A
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, CPL, 0x60, 0xFF, 0x90);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_30(Emulator* emu, u16 operand) { // JR NC, i8
+	Registers* r = &emu->cpu.registers;
+	u8 relative = (u8)operand;
+	u16 jump_to = r->pc + (i8)relative;
+	if (!(read_flags(&emu->cpu) & FLAG_CARRY)) {
+		r->pc = jump_to;
+		return (Cycles) { 2, 12 };
+	}
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles op_31(Emulator* emu, u16 operand) { // LD SP, u16
+	Registers* r = &emu->cpu.registers;
+	u16 src = operand;
+	r->sp = src;
+	return (Cycles) { 3, 12 };
+}
+
+static Cycles op_32(Emulator* emu, u16 operand) { // LD (HL-), A
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->a;
+	write8(emu, r->hl, src);
+	--r->hl;
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_33(Emulator* emu, u16 operand) { // INC SP
+	Registers* r = &emu->cpu.registers;
+	++r->sp;
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_34(Emulator* emu, u16 operand) { // INC (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 prev = read8(emu, r->hl);
+	write8(emu, r->hl, alu8_update(&emu->cpu, prev, 1, INC, 0x00, 0xBF, 0x10));
+	return (Cycles) { 1, 12 };
+}
+
+static Cycles op_35(Emulator* emu, u16 operand) { // DEC (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 prev = read8(emu, r->hl);
+	write8(emu, r->hl, alu8_update(&emu->cpu, prev, 1, DEC, 0x40, 0xFF, 0x10));
+	return (Cycles) { 1, 12 };
+}
+
+static Cycles op_36(Emulator* emu, u16 operand) { // LD (HL), u8
+	Registers* r = &emu->cpu.registers;
+	u8 src = (u8)operand;
+	write8(emu, r->hl, src);
+	return (Cycles) { 2, 12 };
+}
+
+static Cycles op_37(Emulator* emu, u16 operand) { // SCF
+	u8 src = 0x00;
+	u8 dst = 0;
+	alu8_update(&emu->cpu, dst, src, SCF, 0x10, 0x9F, 0x80);
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_38(Emulator* emu, u16 operand) { // JR C, i8
+	Registers* r = &emu->cpu.registers;
+	u8 relative = (u8)operand;
+	u16 jump_to = r->pc + (i8)relative;
+	if ((read_flags(&emu->cpu) & FLAG_CARRY)) {
+		r->pc = jump_to;
+		return (Cycles) { 2, 12 };
+	}
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles op_39(Emulator* emu, u16 operand) { // ADD HL, SP
+	Registers* r = &emu->cpu.registers;
+	u16 dst = r->hl;
+	u16 src = r->sp;
+	alu16_return ret = alu16(&emu->cpu, dst, src, ADD, REGISTER16, 0x00, 0xBF, 0x80);
+	r->hl = ret.result;
+	write_flags(&emu->cpu, ret.flags);
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_3A(Emulator* emu, u16 operand) { // LD A, (HL-)
+	Registers* r = &emu->cpu.registers;
+	u8 src = read8(emu, r->hl);
+	r->a = src;
+	--r->hl;
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_3B(Emulator* emu, u16 operand) { // DEC SP
+	Registers* r = &emu->cpu.registers;
+	--r->sp;
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_3C(Emulator* emu, u16 operand) { // INC A
+	Registers* r = &emu->cpu.registers;
+	r->a = alu8_update(&emu->cpu, r->a, 1, INC, 0x00, 0xBF, 0x10);
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_3D(Emulator* emu, u16 operand) { // DEC A
+	Registers* r = &emu->cpu.registers;
+	r->a = alu8_update(&emu->cpu, r->a, 1, DEC, 0x40, 0xFF, 0x10);
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_3E(Emulator* emu, u16 operand) { // LD A, u8
+	Registers* r = &emu->cpu.registers;
+	u8 src = (u8)operand;
+	r->a = src;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles op_3F(Emulator* emu, u16 operand) { // CCF
+	u8 src = 0x00;
+	u8 dst = 0;
+	alu8_update(&emu->cpu, dst, src, CCF, 0x00, 0x9F, 0x80);
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_40(Emulator* emu, u16 operand) { // LD B, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->b;
+	r->b = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_41(Emulator* emu, u16 operand) { // LD B, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->c;
+	r->b = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_42(Emulator* emu, u16 operand) { // LD B, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->d;
+	r->b = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_43(Emulator* emu, u16 operand) { // LD B, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->e;
+	r->b = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_44(Emulator* emu, u16 operand) { // LD B, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->h;
+	r->b = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_45(Emulator* emu, u16 operand) { // LD B, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->l;
+	r->b = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_46(Emulator* emu, u16 operand) { // LD B, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = read8(emu, r->hl);
+	r->b = src;
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_47(Emulator* emu, u16 operand) { // LD B, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->a;
+	r->b = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_48(Emulator* emu, u16 operand) { // LD C, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->b;
+	r->c = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_49(Emulator* emu, u16 operand) { // LD C, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->c;
+	r->c = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_4A(Emulator* emu, u16 operand) { // LD C, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->d;
+	r->c = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_4B(Emulator* emu, u16 operand) { // LD C, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->e;
+	r->c = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_4C(Emulator* emu, u16 operand) { // LD C, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->h;
+	r->c = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_4D(Emulator* emu, u16 operand) { // LD C, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->l;
+	r->c = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_4E(Emulator* emu, u16 operand) { // LD C, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = read8(emu, r->hl);
+	r->c = src;
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_4F(Emulator* emu, u16 operand) { // LD C, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->a;
+	r->c = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_50(Emulator* emu, u16 operand) { // LD D, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->b;
+	r->d = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_51(Emulator* emu, u16 operand) { // LD D, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->c;
+	r->d = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_52(Emulator* emu, u16 operand) { // LD D, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->d;
+	r->d = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_53(Emulator* emu, u16 operand) { // LD D, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->e;
+	r->d = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_54(Emulator* emu, u16 operand) { // LD D, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->h;
+	r->d = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_55(Emulator* emu, u16 operand) { // LD D, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->l;
+	r->d = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_56(Emulator* emu, u16 operand) { // LD D, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = read8(emu, r->hl);
+	r->d = src;
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_57(Emulator* emu, u16 operand) { // LD D, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->a;
+	r->d = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_58(Emulator* emu, u16 operand) { // LD E, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->b;
+	r->e = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_59(Emulator* emu, u16 operand) { // LD E, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->c;
+	r->e = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_5A(Emulator* emu, u16 operand) { // LD E, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->d;
+	r->e = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_5B(Emulator* emu, u16 operand) { // LD E, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->e;
+	r->e = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_5C(Emulator* emu, u16 operand) { // LD E, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->h;
+	r->e = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_5D(Emulator* emu, u16 operand) { // LD E, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->l;
+	r->e = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_5E(Emulator* emu, u16 operand) { // LD E, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = read8(emu, r->hl);
+	r->e = src;
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_5F(Emulator* emu, u16 operand) { // LD E, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->a;
+	r->e = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_60(Emulator* emu, u16 operand) { // LD H, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->b;
+	r->h = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_61(Emulator* emu, u16 operand) { // LD H, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->c;
+	r->h = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_62(Emulator* emu, u16 operand) { // LD H, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->d;
+	r->h = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_63(Emulator* emu, u16 operand) { // LD H, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->e;
+	r->h = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_64(Emulator* emu, u16 operand) { // LD H, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->h;
+	r->h = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_65(Emulator* emu, u16 operand) { // LD H, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->l;
+	r->h = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_66(Emulator* emu, u16 operand) { // LD H, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = read8(emu, r->hl);
+	r->h = src;
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_67(Emulator* emu, u16 operand) { // LD H, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->a;
+	r->h = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_68(Emulator* emu, u16 operand) { // LD L, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->b;
+	r->l = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_69(Emulator* emu, u16 operand) { // LD L, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->c;
+	r->l = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_6A(Emulator* emu, u16 operand) { // LD L, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->d;
+	r->l = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_6B(Emulator* emu, u16 operand) { // LD L, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->e;
+	r->l = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_6C(Emulator* emu, u16 operand) { // LD L, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->h;
+	r->l = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_6D(Emulator* emu, u16 operand) { // LD L, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->l;
+	r->l = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_6E(Emulator* emu, u16 operand) { // LD L, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = read8(emu, r->hl);
+	r->l = src;
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_6F(Emulator* emu, u16 operand) { // LD L, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->a;
+	r->l = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_70(Emulator* emu, u16 operand) { // LD (HL), B
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->b;
+	write8(emu, r->hl, src);
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_71(Emulator* emu, u16 operand) { // LD (HL), C
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->c;
+	write8(emu, r->hl, src);
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_72(Emulator* emu, u16 operand) { // LD (HL), D
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->d;
+	write8(emu, r->hl, src);
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_73(Emulator* emu, u16 operand) { // LD (HL), E
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->e;
+	write8(emu, r->hl, src);
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_74(Emulator* emu, u16 operand) { // LD (HL), H
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->h;
+	write8(emu, r->hl, src);
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_75(Emulator* emu, u16 operand) { // LD (HL), L
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->l;
+	write8(emu, r->hl, src);
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_76(Emulator* emu, u16 operand) { // HALT
+	emu->cpu.halted = true;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_77(Emulator* emu, u16 operand) { // LD (HL), A
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->a;
+	write8(emu, r->hl, src);
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_78(Emulator* emu, u16 operand) { // LD A, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->b;
+	r->a = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_79(Emulator* emu, u16 operand) { // LD A, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->c;
+	r->a = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_7A(Emulator* emu, u16 operand) { // LD A, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->d;
+	r->a = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_7B(Emulator* emu, u16 operand) { // LD A, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->e;
+	r->a = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_7C(Emulator* emu, u16 operand) { // LD A, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->h;
+	r->a = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_7D(Emulator* emu, u16 operand) { // LD A, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->l;
+	r->a = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_7E(Emulator* emu, u16 operand) { // LD A, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = read8(emu, r->hl);
+	r->a = src;
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_7F(Emulator* emu, u16 operand) { // LD A, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->a;
+	r->a = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_80(Emulator* emu, u16 operand) { // ADD A, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->b;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, ADD, 0x00, 0xBF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_81(Emulator* emu, u16 operand) { // ADD A, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->c;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, ADD, 0x00, 0xBF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_82(Emulator* emu, u16 operand) { // ADD A, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->d;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, ADD, 0x00, 0xBF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_83(Emulator* emu, u16 operand) { // ADD A, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->e;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, ADD, 0x00, 0xBF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_84(Emulator* emu, u16 operand) { // ADD A, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->h;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, ADD, 0x00, 0xBF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_85(Emulator* emu, u16 operand) { // ADD A, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->l;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, ADD, 0x00, 0xBF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_86(Emulator* emu, u16 operand) { // ADD A, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = read8(emu, r->hl);
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, ADD, 0x00, 0xBF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_87(Emulator* emu, u16 operand) { // ADD A, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->a;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, ADD, 0x00, 0xBF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_88(Emulator* emu, u16 operand) { // ADC A, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->b;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, ADC, 0x00, 0xBF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_89(Emulator* emu, u16 operand) { // ADC A, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->c;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, ADC, 0x00, 0xBF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_8A(Emulator* emu, u16 operand) { // ADC A, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->d;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, ADC, 0x00, 0xBF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_8B(Emulator* emu, u16 operand) { // ADC A, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->e;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, ADC, 0x00, 0xBF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_8C(Emulator* emu, u16 operand) { // ADC A, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->h;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, ADC, 0x00, 0xBF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_8D(Emulator* emu, u16 operand) { // ADC A, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->l;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, ADC, 0x00, 0xBF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_8E(Emulator* emu, u16 operand) { // ADC A, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = read8(emu, r->hl);
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, ADC, 0x00, 0xBF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_8F(Emulator* emu, u16 operand) { // ADC A, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->a;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, ADC, 0x00, 0xBF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_90(Emulator* emu, u16 operand) { // SUB A, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->b;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, SUB, 0x40, 0xFF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_91(Emulator* emu, u16 operand) { // SUB A, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->c;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, SUB, 0x40, 0xFF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_92(Emulator* emu, u16 operand) { // SUB A, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->d;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, SUB, 0x40, 0xFF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_93(Emulator* emu, u16 operand) { // SUB A, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->e;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, SUB, 0x40, 0xFF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_94(Emulator* emu, u16 operand) { // SUB A, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->h;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, SUB, 0x40, 0xFF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_95(Emulator* emu, u16 operand) { // SUB A, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->l;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, SUB, 0x40, 0xFF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_96(Emulator* emu, u16 operand) { // SUB A, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = read8(emu, r->hl);
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, SUB, 0x40, 0xFF, 0x00);
+	r->a = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles op_97(Emulator* emu, u16 operand) { // SUB A, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->a;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, SUB, 0x40, 0xFF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_98(Emulator* emu, u16 operand) { // SBC A, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->b;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, SBC, 0x40, 0xFF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_99(Emulator* emu, u16 operand) { // SBC A, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->c;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, SBC, 0x40, 0xFF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_9A(Emulator* emu, u16 operand) { // SBC A, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->d;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, SBC, 0x40, 0xFF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_9B(Emulator* emu, u16 operand) { // SBC A, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->e;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, SBC, 0x40, 0xFF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_9C(Emulator* emu, u16 operand) { // SBC A, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->h;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, SBC, 0x40, 0xFF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_9D(Emulator* emu, u16 operand) { // SBC A, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->l;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, SBC, 0x40, 0xFF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_9E(Emulator* emu, u16 operand) { // SBC A, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = read8(emu, r->hl);
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, SBC, 0x40, 0xFF, 0x00);
+	r->a = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles op_9F(Emulator* emu, u16 operand) { // SBC A, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->a;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, SBC, 0x40, 0xFF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_A0(Emulator* emu, u16 operand) { // AND A, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->b;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, AND, 0x20, 0xAF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_A1(Emulator* emu, u16 operand) { // AND A, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->c;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, AND, 0x20, 0xAF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_A2(Emulator* emu, u16 operand) { // AND A, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->d;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, AND, 0x20, 0xAF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_A3(Emulator* emu, u16 operand) { // AND A, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->e;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, AND, 0x20, 0xAF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_A4(Emulator* emu, u16 operand) { // AND A, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->h;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, AND, 0x20, 0xAF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_A5(Emulator* emu, u16 operand) { // AND A, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->l;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, AND, 0x20, 0xAF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_A6(Emulator* emu, u16 operand) { // AND A, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = read8(emu, r->hl);
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, AND, 0x20, 0xAF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_A7(Emulator* emu, u16 operand) { // AND A, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->a;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, AND, 0x20, 0xAF, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_A8(Emulator* emu, u16 operand) { // XOR A, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->b;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, XOR, 0x00, 0x8F, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_A9(Emulator* emu, u16 operand) { // XOR A, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->c;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, XOR, 0x00, 0x8F, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_AA(Emulator* emu, u16 operand) { // XOR A, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->d;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, XOR, 0x00, 0x8F, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_AB(Emulator* emu, u16 operand) { // XOR A, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->e;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, XOR, 0x00, 0x8F, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_AC(Emulator* emu, u16 operand) { // XOR A, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->h;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, XOR, 0x00, 0x8F, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_AD(Emulator* emu, u16 operand) { // XOR A, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->l;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, XOR, 0x00, 0x8F, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_AE(Emulator* emu, u16 operand) { // XOR A, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = read8(emu, r->hl);
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, XOR, 0x00, 0x8F, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_AF(Emulator* emu, u16 operand) { // XOR A, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->a;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, XOR, 0x00, 0x8F, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_B0(Emulator* emu, u16 operand) { // OR A, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->b;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, OR, 0x00, 0x8F, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_B1(Emulator* emu, u16 operand) { // OR A, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->c;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, OR, 0x00, 0x8F, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_B2(Emulator* emu, u16 operand) { // OR A, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->d;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, OR, 0x00, 0x8F, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_B3(Emulator* emu, u16 operand) { // OR A, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->e;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, OR, 0x00, 0x8F, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_B4(Emulator* emu, u16 operand) { // OR A, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->h;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, OR, 0x00, 0x8F, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_B5(Emulator* emu, u16 operand) { // OR A, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->l;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, OR, 0x00, 0x8F, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_B6(Emulator* emu, u16 operand) { // OR A, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = read8(emu, r->hl);
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, OR, 0x00, 0x8F, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_B7(Emulator* emu, u16 operand) { // OR A, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->a;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, OR, 0x00, 0x8F, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_B8(Emulator* emu, u16 operand) { // CP A, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->b;
+	u8 dst = r->a;
+	alu8_update(&emu->cpu, dst, src, CP, 0x40, 0xFF, 0x00);
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_B9(Emulator* emu, u16 operand) { // CP A, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->c;
+	u8 dst = r->a;
+	alu8_update(&emu->cpu, dst, src, CP, 0x40, 0xFF, 0x00);
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_BA(Emulator* emu, u16 operand) { // CP A, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->d;
+	u8 dst = r->a;
+	alu8_update(&emu->cpu, dst, src, CP, 0x40, 0xFF, 0x00);
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_BB(Emulator* emu, u16 operand) { // CP A, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->e;
+	u8 dst = r->a;
+	alu8_update(&emu->cpu, dst, src, CP, 0x40, 0xFF, 0x00);
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_BC(Emulator* emu, u16 operand) { // CP A, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->h;
+	u8 dst = r->a;
+	alu8_update(&emu->cpu, dst, src, CP, 0x40, 0xFF, 0x00);
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_BD(Emulator* emu, u16 operand) { // CP A, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->l;
+	u8 dst = r->a;
+	alu8_update(&emu->cpu, dst, src, CP, 0x40, 0xFF, 0x00);
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_BE(Emulator* emu, u16 operand) { // CP A, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = read8(emu, r->hl);
+	u8 dst = r->a;
+	alu8_update(&emu->cpu, dst, src, CP, 0x40, 0xFF, 0x00);
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_BF(Emulator* emu, u16 operand) { // CP A, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->a;
+	u8 dst = r->a;
+	alu8_update(&emu->cpu, dst, src, CP, 0x40, 0xFF, 0x00);
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_C0(Emulator* emu, u16 operand) { // RET NZ
+	Registers* r = &emu->cpu.registers;
+	if (!zero_flag(&emu->cpu)) {
+		r->pc = read16(emu, r->sp);
+		r->sp += 2;
+		sampler_return(emu);
+		return (Cycles) { 1, 20 };
+	}
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_C1(Emulator* emu, u16 operand) { // POP BC
+	Registers* r = &emu->cpu.registers;
+	r->bc = read16(emu, r->sp);
+	r->sp += 2;
+	return (Cycles) { 1, 12 };
+}
+
+static Cycles op_C2(Emulator* emu, u16 operand) { // JP NZ u16
+	Registers* r = &emu->cpu.registers;
+	u16 src = operand;
+	if (!zero_flag(&emu->cpu)) {
+		r->pc = src;
+		return (Cycles) { 3, 16 };
+	}
+	return (Cycles) { 3, 12 };
+}
+
+static Cycles op_C3(Emulator* emu, u16 operand) { // JP u16
+	Registers* r = &emu->cpu.registers;
+	u16 src = operand;
+	r->pc = src;
+	return (Cycles) { 3, 16 };
+}
+
+static Cycles op_C4(Emulator* emu, u16 operand) { // CALL NZ u16
+	Registers* r = &emu->cpu.registers;
+	u16 src = operand;
+	if (!zero_flag(&emu->cpu)) {
+		write16(emu, r->sp - 2, r->pc);
+		r->sp -= 2;
+		r->pc = src;
+		sampler_call(emu);
+	}
+	return (Cycles) { 3, 24 };
+}
+
+static Cycles op_C5(Emulator* emu, u16 operand) { // PUSH BC
+	Registers* r = &emu->cpu.registers;
+	write16(emu, r->sp - 2, r->bc);
+	r->sp -= 2;
+	return (Cycles) { 1, 16 };
+}
+
+static Cycles op_C6(Emulator* emu, u16 operand) { // ADD A, u8
+	Registers* r = &emu->cpu.registers;
+	u8 src = (u8)operand;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, ADD, 0x00, 0xBF, 0x00);
+	r->a = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles op_C7(Emulator* emu, u16 operand) { // RST 00
+	Registers* r = &emu->cpu.registers;
+	write16(emu, r->sp - 2, r->pc);
+	r->sp -= 2;
+	r->pc = 0x0000;
+	sampler_call(emu);
+	return (Cycles) { 1, 16 };
+}
+
+static Cycles op_C8(Emulator* emu, u16 operand) { // RET Z
+	Registers* r = &emu->cpu.registers;
+	if (zero_flag(&emu->cpu)) {
+		r->pc = read16(emu, r->sp);
+		r->sp += 2;
+		sampler_return(emu);
+		return (Cycles) { 1, 20 };
+	}
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_C9(Emulator* emu, u16 operand) { // RET
+	Registers* r = &emu->cpu.registers;
+	r->pc = read16(emu, r->sp);
+	r->sp += 2;
+	sampler_return(emu);
+	return (Cycles) { 1, 16 };
+}
+
+static Cycles op_CA(Emulator* emu, u16 operand) { // JP Z u16
+	Registers* r = &emu->cpu.registers;
+	u16 src = operand;
+	if (zero_flag(&emu->cpu)) {
+		r->pc = src;
+		return (Cycles) { 3, 16 };
+	}
+	return (Cycles) { 3, 12 };
+}
+
+static Cycles op_CB(Emulator* emu, u16 operand) { // PREFIX CB
+	Cycles c = fast_cb_handlers[(u8)operand](emu, 0);
+	return c;
+}
+
+static Cycles op_CC(Emulator* emu, u16 operand) { // CALL Z u16
+	Registers* r = &emu->cpu.registers;
+	u16 src = operand;
+	if (zero_flag(&emu->cpu)) {
+		write16(emu, r->sp - 2, r->pc);
+		r->sp -= 2;
+		r->pc = src;
+		sampler_call(emu);
+	}
+	return (Cycles) { 3, 24 };
+}
+
+static Cycles op_CD(Emulator* emu, u16 operand) { // CALL u16
+	Registers* r = &emu->cpu.registers;
+	u16 src = operand;
+	write16(emu, r->sp - 2, r->pc);
+	r->sp -= 2;
+	r->pc = src;
+	sampler_call(emu);
+	return (Cycles) { 3, 24 };
+}
+
+static Cycles op_CE(Emulator* emu, u16 operand) { // ADC A, u8
+	Registers* r = &emu->cpu.registers;
+	u8 src = (u8)operand;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, ADC, 0x00, 0xBF, 0x00);
+	r->a = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles op_CF(Emulator* emu, u16 operand) { // RST 08
+	Registers* r = &emu->cpu.registers;
+	write16(emu, r->sp - 2, r->pc);
+	r->sp -= 2;
+	r->pc = 0x0008;
+	sampler_call(emu);
+	return (Cycles) { 1, 16 };
+}
+
+static Cycles op_D0(Emulator* emu, u16 operand) { // RET NC
+	Registers* r = &emu->cpu.registers;
+	if (!(read_flags(&emu->cpu) & FLAG_CARRY)) {
+		r->pc = read16(emu, r->sp);
+		r->sp += 2;
+		sampler_return(emu);
+		return (Cycles) { 1, 20 };
+	}
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_D1(Emulator* emu, u16 operand) { // POP DE
+	Registers* r = &emu->cpu.registers;
+	r->de = read16(emu, r->sp);
+	r->sp += 2;
+	return (Cycles) { 1, 12 };
+}
+
+static Cycles op_D2(Emulator* emu, u16 operand) { // JP NC u16
+	Registers* r = &emu->cpu.registers;
+	u16 src = operand;
+	if (!(read_flags(&emu->cpu) & FLAG_CARRY)) {
+		r->pc = src;
+		return (Cycles) { 3, 16 };
+	}
+	return (Cycles) { 3, 12 };
+}
+
+static Cycles op_D3(Emulator* emu, u16 operand) { // unimplemented
+	return (Cycles) { 0, 0 };
+}
+
+static Cycles op_D4(Emulator* emu, u16 operand) { // CALL NC u16
+	Registers* r = &emu->cpu.registers;
+	u16 src = operand;
+	if (!(read_flags(&emu->cpu) & FLAG_CARRY)) {
+		write16(emu, r->sp - 2, r->pc);
+		r->sp -= 2;
+		r->pc = src;
+		sampler_call(emu);
+	}
+	return (Cycles) { 3, 24 };
+}
+
+static Cycles op_D5(Emulator* emu, u16 operand) { // PUSH DE
+	Registers* r = &emu->cpu.registers;
+	write16(emu, r->sp - 2, r->de);
+	r->sp -= 2;
+	return (Cycles) { 1, 16 };
+}
+
+static Cycles op_D6(Emulator* emu, u16 operand) { // SUB A, u8
+	Registers* r = &emu->cpu.registers;
+	u8 src = (u8)operand;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, SUB, 0x40, 0xFF, 0x00);
+	r->a = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles op_D7(Emulator* emu, u16 operand) { // RST 10
+	Registers* r = &emu->cpu.registers;
+	write16(emu, r->sp - 2, r->pc);
+	r->sp -= 2;
+	r->pc = 0x0010;
+	sampler_call(emu);
+	return (Cycles) { 1, 16 };
+}
+
+static Cycles op_D8(Emulator* emu, u16 operand) { // RET C
+	Registers* r = &emu->cpu.registers;
+	if ((read_flags(&emu->cpu) & FLAG_CARRY)) {
+		r->pc = read16(emu, r->sp);
+		r->sp += 2;
+		sampler_return(emu);
+		return (Cycles) { 1, 20 };
+	}
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_D9(Emulator* emu, u16 operand) { // RETI
+	Registers* r = &emu->cpu.registers;
+	r->pc = read16(emu, r->sp);
+	r->sp += 2;
+	sampler_return(emu);
+	update_IME(&emu->cpu, true);
+	return (Cycles) { 1, 16 };
+}
+
+static Cycles op_DA(Emulator* emu, u16 operand) { // JP C u16
+	Registers* r = &emu->cpu.registers;
+	u16 src = operand;
+	if ((read_flags(&emu->cpu) & FLAG_CARRY)) {
+		r->pc = src;
+		return (Cycles) { 3, 16 };
+	}
+	return (Cycles) { 3, 12 };
+}
+
+static Cycles op_DB(Emulator* emu, u16 operand) { // unimplemented
+	return (Cycles) { 0, 0 };
+}
+
+static Cycles op_DC(Emulator* emu, u16 operand) { // CALL C u16
+	Registers* r = &emu->cpu.registers;
+	u16 src = operand;
+	if ((read_flags(&emu->cpu) & FLAG_CARRY)) {
+		write16(emu, r->sp - 2, r->pc);
+		r->sp -= 2;
+		r->pc = src;
+		sampler_call(emu);
+	}
+	return (Cycles) { 3, 24 };
+}
+
+static Cycles op_DD(Emulator* emu, u16 operand) { // unimplemented
+	return (Cycles) { 0, 0 };
+}
+
+static Cycles op_DE(Emulator* emu, u16 operand) { // SBC A, u8
+	Registers* r = &emu->cpu.registers;
+	u8 src = (u8)operand;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, SBC, 0x40, 0xFF, 0x00);
+	r->a = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles op_DF(Emulator* emu, u16 operand) { // RST 18
+	Registers* r = &emu->cpu.registers;
+	write16(emu, r->sp - 2, r->pc);
+	r->sp -= 2;
+	r->pc = 0x0018;
+	sampler_call(emu);
+	return (Cycles) { 1, 16 };
+}
+
+static Cycles op_E0(Emulator* emu, u16 operand) { // LD (FF00 + u8), A
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->a;
+	write8(emu, 0xFF00 + (u8)operand, src);
+	return (Cycles) { 2, 12 };
+}
+
+static Cycles op_E1(Emulator* emu, u16 operand) { // POP HL
+	Registers* r = &emu->cpu.registers;
+	r->hl = read16(emu, r->sp);
+	r->sp += 2;
+	return (Cycles) { 1, 12 };
+}
+
+static Cycles op_E2(Emulator* emu, u16 operand) { // LD (FF00 + C), A
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->a;
+	write8(emu, 0xFF00 + r->c, src);
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_E3(Emulator* emu, u16 operand) { // unimplemented
+	return (Cycles) { 0, 0 };
+}
+
+static Cycles op_E4(Emulator* emu, u16 operand) { // unimplemented
+	return (Cycles) { 0, 0 };
+}
+
+static Cycles op_E5(Emulator* emu, u16 operand) { // PUSH HL
+	Registers* r = &emu->cpu.registers;
+	write16(emu, r->sp - 2, r->hl);
+	r->sp -= 2;
+	return (Cycles) { 1, 16 };
+}
+
+static Cycles op_E6(Emulator* emu, u16 operand) { // AND A, u8
+	Registers* r = &emu->cpu.registers;
+	u8 src = (u8)operand;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, AND, 0x20, 0xAF, 0x00);
+	r->a = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles op_E7(Emulator* emu, u16 operand) { // RST 20
+	Registers* r = &emu->cpu.registers;
+	write16(emu, r->sp - 2, r->pc);
+	r->sp -= 2;
+	r->pc = 0x0020;
+	sampler_call(emu);
+	return (Cycles) { 1, 16 };
+}
+
+static Cycles op_E8(Emulator* emu, u16 operand) { // ADD SP, i8
+	Registers* r = &emu->cpu.registers;
+	u16 dst = r->sp;
+	u16 src = (i16)(i8)operand;
+	alu16_return ret = alu16(&emu->cpu, dst, src, ADD, MEM_READ, 0x00, 0x3F, 0x00);
+	r->sp = ret.result;
+	write_flags(&emu->cpu, ret.flags);
+	return (Cycles) { 2, 16 };
+}
+
+static Cycles op_E9(Emulator* emu, u16 operand) { // JP HL
+	Registers* r = &emu->cpu.registers;
+	u16 src = r->hl;
+	r->pc = src;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_EA(Emulator* emu, u16 operand) { // LD (u16), A
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->a;
+	write8(emu, operand, src);
+	return (Cycles) { 3, 16 };
+}
+
+static Cycles op_EB(Emulator* emu, u16 operand) { // unimplemented
+	return (Cycles) { 0, 0 };
+}
+
+static Cycles op_EC(Emulator* emu, u16 operand) { // unimplemented
+	return (Cycles) { 0, 0 };
+}
+
+static Cycles op_ED(Emulator* emu, u16 operand) { // unimplemented
+	return (Cycles) { 0, 0 };
+}
+
+static Cycles op_EE(Emulator* emu, u16 operand) { // XOR A, u8
+	Registers* r = &emu->cpu.registers;
+	u8 src = (u8)operand;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, XOR, 0x00, 0x8F, 0x00);
+	r->a = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles op_EF(Emulator* emu, u16 operand) { // RST 28
+	Registers* r = &emu->cpu.registers;
+	write16(emu, r->sp - 2, r->pc);
+	r->sp -= 2;
+	r->pc = 0x0028;
+	sampler_call(emu);
+	return (Cycles) { 1, 16 };
+}
+
+static Cycles op_F0(Emulator* emu, u16 operand) { // LD A, (FF00 + u8)
+	Registers* r = &emu->cpu.registers;
+	u8 src = read8(emu, 0xFF00 + (u8)operand);
+	r->a = src;
+	return (Cycles) { 2, 12 };
+}
+
+static Cycles op_F1(Emulator* emu, u16 operand) { // POP AF
+	Registers* r = &emu->cpu.registers;
+	r->af = read16(emu, r->sp);
+	write_flags(&emu->cpu, r->f & 0xF0);
+	r->sp += 2;
+	return (Cycles) { 1, 12 };
+}
+
+static Cycles op_F2(Emulator* emu, u16 operand) { // LD A, (FF00 + C)
+	Registers* r = &emu->cpu.registers;
+	u8 src = read8(emu, 0xFF00 + r->c);
+	r->a = src;
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_F3(Emulator* emu, u16 operand) { // DI
+	update_IME(&emu->cpu, false);
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_F4(Emulator* emu, u16 operand) { // unimplemented
+	return (Cycles) { 0, 0 };
+}
+
+static Cycles op_F5(Emulator* emu, u16 operand) { // PUSH AF
+	Registers* r = &emu->cpu.registers;
+	resolve_flags(&emu->cpu);
+	write16(emu, r->sp - 2, r->af);
+	r->sp -= 2;
+	return (Cycles) { 1, 16 };
+}
+
+static Cycles op_F6(Emulator* emu, u16 operand) { // OR A, U8
+	Registers* r = &emu->cpu.registers;
+	u8 src = (u8)operand;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, OR, 0x00, 0x8F, 0x00);
+	r->a = result;
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_F7(Emulator* emu, u16 operand) { // RST 30
+	Registers* r = &emu->cpu.registers;
+	write16(emu, r->sp - 2, r->pc);
+	r->sp -= 2;
+	r->pc = 0x0030;
+	sampler_call(emu);
+	return (Cycles) { 1, 16 };
+}
+
+static Cycles op_F8(Emulator* emu, u16 operand) { // LD HL, SP + i8
+	Registers* r = &emu->cpu.registers;
+	u16 offset = (i16)(i8)operand;
+	alu16_return sp_ret = alu16(&emu->cpu, r->sp, offset, ADD, MEM_READ, 0x00, 0x3F, 0x00);
+	write_flags(&emu->cpu, sp_ret.flags);
+	u16 src = sp_ret.result;
+	r->hl = src;
+	return (Cycles) { 2, 12 };
+}
+
+static Cycles op_F9(Emulator* emu, u16 operand) { // LD SP, HL
+	Registers* r = &emu->cpu.registers;
+	u16 src = r->hl;
+	r->sp = src;
+	return (Cycles) { 1, 8 };
+}
+
+static Cycles op_FA(Emulator* emu, u16 operand) { // LD A, (u16)
+	Registers* r = &emu->cpu.registers;
+	u8 src = read8(emu, operand);
+	r->a = src;
+	return (Cycles) { 3, 16 };
+}
+
+static Cycles op_FB(Emulator* emu, u16 operand) { // EI
+	update_IME(&emu->cpu, true);
+	return (Cycles) { 1, 4 };
+}
+
+static Cycles op_FC(Emulator* emu, u16 operand) { // unimplemented
+	return (Cycles) { 0, 0 };
+}
+
+static Cycles op_FD(Emulator* emu, u16 operand) { // unimplemented
+	return (Cycles) { 0, 0 };
+}
+
+static Cycles op_FE(Emulator* emu, u16 operand) { // CP A, u8
+	Registers* r = &emu->cpu.registers;
+	u8 src = (u8)operand;
+	u8 dst = r->a;
+	alu8_update(&emu->cpu, dst, src, CP, 0x40, 0xFF, 0x00);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles op_FF(Emulator* emu, u16 operand) { // RST 38
+	Registers* r = &emu->cpu.registers;
+	write16(emu, r->sp - 2, r->pc);
+	r->sp -= 2;
+	r->pc = 0x0038;
+	sampler_call(emu);
+	return (Cycles) { 1, 16 };
+}
+
+static Cycles cb_00(Emulator* emu, u16 operand) { // RLC B
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->b;
+	u8 result = alu8_update(&emu->cpu, dst, src, RLC, 0x00, 0x9F, 0x00);
+	r->b = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_01(Emulator* emu, u16 operand) { // RLC C
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->c;
+	u8 result = alu8_update(&emu->cpu, dst, src, RLC, 0x00, 0x9F, 0x00);
+	r->c = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_02(Emulator* emu, u16 operand) { // RLC D
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->d;
+	u8 result = alu8_update(&emu->cpu, dst, src, RLC, 0x00, 0x9F, 0x00);
+	r->d = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_03(Emulator* emu, u16 operand) { // RLC E
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->e;
+	u8 result = alu8_update(&emu->cpu, dst, src, RLC, 0x00, 0x9F, 0x00);
+	r->e = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_04(Emulator* emu, u16 operand) { // RLC H
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->h;
+	u8 result = alu8_update(&emu->cpu, dst, src, RLC, 0x00, 0x9F, 0x00);
+	r->h = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_05(Emulator* emu, u16 operand) { // RLC L
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->l;
+	u8 result = alu8_update(&emu->cpu, dst, src, RLC, 0x00, 0x9F, 0x00);
+	r->l = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_06(Emulator* emu, u16 operand) { // RLC (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = read8(emu, r->hl);
+	u8 result = alu8_update(&emu->cpu, dst, src, RLC, 0x00, 0x9F, 0x00);
+	write8(emu, r->hl, result);
+	return (Cycles) { 2, 16 };
+}
+
+static Cycles cb_07(Emulator* emu, u16 operand) { // RLC A
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, RLC, 0x00, 0x9F, 0x00);
+	r->a = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_08(Emulator* emu, u16 operand) { // RRC B
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->b;
+	u8 result = alu8_update(&emu->cpu, dst, src, RRC, 0x00, 0x9F, 0x00);
+	r->b = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_09(Emulator* emu, u16 operand) { // RRC C
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->c;
+	u8 result = alu8_update(&emu->cpu, dst, src, RRC, 0x00, 0x9F, 0x00);
+	r->c = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_0A(Emulator* emu, u16 operand) { // RRC D
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->d;
+	u8 result = alu8_update(&emu->cpu, dst, src, RRC, 0x00, 0x9F, 0x00);
+	r->d = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_0B(Emulator* emu, u16 operand) { // RRC E
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->e;
+	u8 result = alu8_update(&emu->cpu, dst, src, RRC, 0x00, 0x9F, 0x00);
+	r->e = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_0C(Emulator* emu, u16 operand) { // RRC H
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->h;
+	u8 result = alu8_update(&emu->cpu, dst, src, RRC, 0x00, 0x9F, 0x00);
+	r->h = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_0D(Emulator* emu, u16 operand) { // RRC L
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->l;
+	u8 result = alu8_update(&emu->cpu, dst, src, RRC, 0x00, 0x9F, 0x00);
+	r->l = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_0E(Emulator* emu, u16 operand) { // RRC (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = read8(emu, r->hl);
+	u8 result = alu8_update(&emu->cpu, dst, src, RRC, 0x00, 0x9F, 0x00);
+	write8(emu, r->hl, result);
+	return (Cycles) { 2, 16 };
+}
+
+static Cycles cb_0F(Emulator* emu, u16 operand) { // RRC A
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, RRC, 0x00, 0x9F, 0x00);
+	r->a = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_10(Emulator* emu, u16 operand) { // RL B
+	Registers* r = &emu->cpu.registers;
+	u8 dst = r->b;
+	u8 result = alu8_update(&emu->cpu, dst, 0, RL, 0x00, 0x9F, 0x00);
+	r->b = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_11(Emulator* emu, u16 operand) { // RL C
+	Registers* r = &emu->cpu.registers;
+	u8 dst = r->c;
+	u8 result = alu8_update(&emu->cpu, dst, 0, RL, 0x00, 0x9F, 0x00);
+	r->c = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_12(Emulator* emu, u16 operand) { // RL D
+	Registers* r = &emu->cpu.registers;
+	u8 dst = r->d;
+	u8 result = alu8_update(&emu->cpu, dst, 0, RL, 0x00, 0x9F, 0x00);
+	r->d = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_13(Emulator* emu, u16 operand) { // RL E
+	Registers* r = &emu->cpu.registers;
+	u8 dst = r->e;
+	u8 result = alu8_update(&emu->cpu, dst, 0, RL, 0x00, 0x9F, 0x00);
+	r->e = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_14(Emulator* emu, u16 operand) { // RL H
+	Registers* r = &emu->cpu.registers;
+	u8 dst = r->h;
+	u8 result = alu8_update(&emu->cpu, dst, 0, RL, 0x00, 0x9F, 0x00);
+	r->h = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_15(Emulator* emu, u16 operand) { // RL L
+	Registers* r = &emu->cpu.registers;
+	u8 dst = r->l;
+	u8 result = alu8_update(&emu->cpu, dst, 0, RL, 0x00, 0x9F, 0x00);
+	r->l = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_16(Emulator* emu, u16 operand) { // RL (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 dst = read8(emu, r->hl);
+	u8 result = alu8_update(&emu->cpu, dst, 0, RL, 0x00, 0x9F, 0x00);
+	write8(emu, r->hl, result);
+	return (Cycles) { 2, 16 };
+}
+
+static Cycles cb_17(Emulator* emu, u16 operand) { // RL A
+	Registers* r = &emu->cpu.registers;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, 0, RL, 0x00, 0x9F, 0x00);
+	r->a = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_18(Emulator* emu, u16 operand) { // RR B
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->b;
+	u8 result = alu8_update(&emu->cpu, dst, src, RR, 0x00, 0x9F, 0x00);
+	r->b = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_19(Emulator* emu, u16 operand) { // RR C
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->c;
+	u8 result = alu8_update(&emu->cpu, dst, src, RR, 0x00, 0x9F, 0x00);
+	r->c = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_1A(Emulator* emu, u16 operand) { // RR D
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->d;
+	u8 result = alu8_update(&emu->cpu, dst, src, RR, 0x00, 0x9F, 0x00);
+	r->d = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_1B(Emulator* emu, u16 operand) { // RR E
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->e;
+	u8 result = alu8_update(&emu->cpu, dst, src, RR, 0x00, 0x9F, 0x00);
+	r->e = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_1C(Emulator* emu, u16 operand) { // RR H
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->h;
+	u8 result = alu8_update(&emu->cpu, dst, src, RR, 0x00, 0x9F, 0x00);
+	r->h = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_1D(Emulator* emu, u16 operand) { // RR L
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->l;
+	u8 result = alu8_update(&emu->cpu, dst, src, RR, 0x00, 0x9F, 0x00);
+	r->l = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_1E(Emulator* emu, u16 operand) { // RR (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = read8(emu, r->hl);
+	u8 result = alu8_update(&emu->cpu, dst, src, RR, 0x00, 0x9F, 0x00);
+	write8(emu, r->hl, result);
+	return (Cycles) { 2, 16 };
+}
+
+static Cycles cb_1F(Emulator* emu, u16 operand) { // RR A
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, RR, 0x00, 0x9F, 0x00);
+	r->a = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_20(Emulator* emu, u16 operand) { // SLA B
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->b;
+	u8 result = alu8_update(&emu->cpu, dst, src, SLA, 0x00, 0x9F, 0x00);
+	r->b = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_21(Emulator* emu, u16 operand) { // SLA C
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->c;
+	u8 result = alu8_update(&emu->cpu, dst, src, SLA, 0x00, 0x9F, 0x00);
+	r->c = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_22(Emulator* emu, u16 operand) { // SLA D
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->d;
+	u8 result = alu8_update(&emu->cpu, dst, src, SLA, 0x00, 0x9F, 0x00);
+	r->d = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_23(Emulator* emu, u16 operand) { // SLA E
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->e;
+	u8 result = alu8_update(&emu->cpu, dst, src, SLA, 0x00, 0x9F, 0x00);
+	r->e = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_24(Emulator* emu, u16 operand) { // SLA H
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->h;
+	u8 result = alu8_update(&emu->cpu, dst, src, SLA, 0x00, 0x9F, 0x00);
+	r->h = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_25(Emulator* emu, u16 operand) { // SLA L
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->l;
+	u8 result = alu8_update(&emu->cpu, dst, src, SLA, 0x00, 0x9F, 0x00);
+	r->l = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_26(Emulator* emu, u16 operand) { // SLA (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = read8(emu, r->hl);
+	u8 result = alu8_update(&emu->cpu, dst, src, SLA, 0x00, 0x9F, 0x00);
+	write8(emu, r->hl, result);
+	return (Cycles) { 2, 16 };
+}
+
+static Cycles cb_27(Emulator* emu, u16 operand) { // SLA A
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, SLA, 0x00, 0x9F, 0x00);
+	r->a = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_28(Emulator* emu, u16 operand) { // SRA B
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->b;
+	u8 result = alu8_update(&emu->cpu, dst, src, SRA, 0x00, 0x9F, 0x00);
+	r->b = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_29(Emulator* emu, u16 operand) { // SRA C
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->c;
+	u8 result = alu8_update(&emu->cpu, dst, src, SRA, 0x00, 0x9F, 0x00);
+	r->c = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_2A(Emulator* emu, u16 operand) { // SRA D
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->d;
+	u8 result = alu8_update(&emu->cpu, dst, src, SRA, 0x00, 0x9F, 0x00);
+	r->d = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_2B(Emulator* emu, u16 operand) { // SRA E
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->e;
+	u8 result = alu8_update(&emu->cpu, dst, src, SRA, 0x00, 0x9F, 0x00);
+	r->e = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_2C(Emulator* emu, u16 operand) { // SRA H
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->h;
+	u8 result = alu8_update(&emu->cpu, dst, src, SRA, 0x00, 0x9F, 0x00);
+	r->h = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_2D(Emulator* emu, u16 operand) { // SRA L
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->l;
+	u8 result = alu8_update(&emu->cpu, dst, src, SRA, 0x00, 0x9F, 0x00);
+	r->l = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_2E(Emulator* emu, u16 operand) { // SRA (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = read8(emu, r->hl);
+	u8 result = alu8_update(&emu->cpu, dst, src, SRA, 0x00, 0x9F, 0x00);
+	write8(emu, r->hl, result);
+	return (Cycles) { 2, 16 };
+}
+
+static Cycles cb_2F(Emulator* emu, u16 operand) { // SRA A
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, SRA, 0x00, 0x9F, 0x00);
+	r->a = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_30(Emulator* emu, u16 operand) { // SWAP B
+	Registers* r = &emu->cpu.registers;
+	u8 dst = r->b;
+	u8 result = alu8_update(&emu->cpu, dst, 0, SWAP, 0x00, 0x8F, 0x00);
+	r->b = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_31(Emulator* emu, u16 operand) { // SWAP C
+	Registers* r = &emu->cpu.registers;
+	u8 dst = r->c;
+	u8 result = alu8_update(&emu->cpu, dst, 0, SWAP, 0x00, 0x8F, 0x00);
+	r->c = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_32(Emulator* emu, u16 operand) { // SWAP D
+	Registers* r = &emu->cpu.registers;
+	u8 dst = r->d;
+	u8 result = alu8_update(&emu->cpu, dst, 0, SWAP, 0x00, 0x8F, 0x00);
+	r->d = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_33(Emulator* emu, u16 operand) { // SWAP E
+	Registers* r = &emu->cpu.registers;
+	u8 dst = r->e;
+	u8 result = alu8_update(&emu->cpu, dst, 0, SWAP, 0x00, 0x8F, 0x00);
+	r->e = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_34(Emulator* emu, u16 operand) { // SWAP H
+	Registers* r = &emu->cpu.registers;
+	u8 dst = r->h;
+	u8 result = alu8_update(&emu->cpu, dst, 0, SWAP, 0x00, 0x8F, 0x00);
+	r->h = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_35(Emulator* emu, u16 operand) { // SWAP L
+	Registers* r = &emu->cpu.registers;
+	u8 dst = r->l;
+	u8 result = alu8_update(&emu->cpu, dst, 0, SWAP, 0x00, 0x8F, 0x00);
+	r->l = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_36(Emulator* emu, u16 operand) { // SWAP (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 dst = read8(emu, r->hl);
+	u8 result = alu8_update(&emu->cpu, dst, 0, SWAP, 0x00, 0x8F, 0x00);
+	write8(emu, r->hl, result);
+	return (Cycles) { 2, 16 };
+}
+
+static Cycles cb_37(Emulator* emu, u16 operand) { // SWAP A
+	Registers* r = &emu->cpu.registers;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, 0, SWAP, 0x00, 0x8F, 0x00);
+	r->a = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_38(Emulator* emu, u16 operand) { // SRL B
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->b;
+	u8 result = alu8_update(&emu->cpu, dst, src, SRL, 0x00, 0x9F, 0x00);
+	r->b = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_39(Emulator* emu, u16 operand) { // SRL C
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->c;
+	u8 result = alu8_update(&emu->cpu, dst, src, SRL, 0x00, 0x9F, 0x00);
+	r->c = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_3A(Emulator* emu, u16 operand) { // SRL D
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->d;
+	u8 result = alu8_update(&emu->cpu, dst, src, SRL, 0x00, 0x9F, 0x00);
+	r->d = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_3B(Emulator* emu, u16 operand) { // SRL E
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->e;
+	u8 result = alu8_update(&emu->cpu, dst, src, SRL, 0x00, 0x9F, 0x00);
+	r->e = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_3C(Emulator* emu, u16 operand) { // SRL H
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->h;
+	u8 result = alu8_update(&emu->cpu, dst, src, SRL, 0x00, 0x9F, 0x00);
+	r->h = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_3D(Emulator* emu, u16 operand) { // SRL L
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->l;
+	u8 result = alu8_update(&emu->cpu, dst, src, SRL, 0x00, 0x9F, 0x00);
+	r->l = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_3E(Emulator* emu, u16 operand) { // SRL (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = read8(emu, r->hl);
+	u8 result = alu8_update(&emu->cpu, dst, src, SRL, 0x00, 0x9F, 0x00);
+	write8(emu, r->hl, result);
+	return (Cycles) { 2, 16 };
+}
+
+static Cycles cb_3F(Emulator* emu, u16 operand) { // SRL A
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, SRL, 0x00, 0x9F, 0x00);
+	r->a = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_40(Emulator* emu, u16 operand) { // BIT 0, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->b;
+	alu8_update(&emu->cpu, src, 0x01, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_41(Emulator* emu, u16 operand) { // BIT 0, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->c;
+	alu8_update(&emu->cpu, src, 0x01, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_42(Emulator* emu, u16 operand) { // BIT 0, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->d;
+	alu8_update(&emu->cpu, src, 0x01, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_43(Emulator* emu, u16 operand) { // BIT 0, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->e;
+	alu8_update(&emu->cpu, src, 0x01, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_44(Emulator* emu, u16 operand) { // BIT 0, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->h;
+	alu8_update(&emu->cpu, src, 0x01, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_45(Emulator* emu, u16 operand) { // BIT 0, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->l;
+	alu8_update(&emu->cpu, src, 0x01, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_46(Emulator* emu, u16 operand) { // BIT 0, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = read8(emu, r->hl);
+	alu8_update(&emu->cpu, src, 0x01, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_47(Emulator* emu, u16 operand) { // BIT 0, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->a;
+	alu8_update(&emu->cpu, src, 0x01, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_48(Emulator* emu, u16 operand) { // BIT 1, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->b;
+	alu8_update(&emu->cpu, src, 0x02, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_49(Emulator* emu, u16 operand) { // BIT 1, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->c;
+	alu8_update(&emu->cpu, src, 0x02, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_4A(Emulator* emu, u16 operand) { // BIT 1, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->d;
+	alu8_update(&emu->cpu, src, 0x02, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_4B(Emulator* emu, u16 operand) { // BIT 1, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->e;
+	alu8_update(&emu->cpu, src, 0x02, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_4C(Emulator* emu, u16 operand) { // BIT 1, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->h;
+	alu8_update(&emu->cpu, src, 0x02, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_4D(Emulator* emu, u16 operand) { // BIT 1, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->l;
+	alu8_update(&emu->cpu, src, 0x02, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_4E(Emulator* emu, u16 operand) { // BIT 1, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = read8(emu, r->hl);
+	alu8_update(&emu->cpu, src, 0x02, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_4F(Emulator* emu, u16 operand) { // BIT 1, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->a;
+	alu8_update(&emu->cpu, src, 0x02, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_50(Emulator* emu, u16 operand) { // BIT 2, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->b;
+	alu8_update(&emu->cpu, src, 0x04, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_51(Emulator* emu, u16 operand) { // BIT 2, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->c;
+	alu8_update(&emu->cpu, src, 0x04, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_52(Emulator* emu, u16 operand) { // BIT 2, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->d;
+	alu8_update(&emu->cpu, src, 0x04, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_53(Emulator* emu, u16 operand) { // BIT 2, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->e;
+	alu8_update(&emu->cpu, src, 0x04, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_54(Emulator* emu, u16 operand) { // BIT 2, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->h;
+	alu8_update(&emu->cpu, src, 0x04, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_55(Emulator* emu, u16 operand) { // BIT 2, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->l;
+	alu8_update(&emu->cpu, src, 0x04, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_56(Emulator* emu, u16 operand) { // BIT 2, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = read8(emu, r->hl);
+	alu8_update(&emu->cpu, src, 0x04, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_57(Emulator* emu, u16 operand) { // BIT 2, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->a;
+	alu8_update(&emu->cpu, src, 0x04, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_58(Emulator* emu, u16 operand) { // BIT 3, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->b;
+	alu8_update(&emu->cpu, src, 0x08, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_59(Emulator* emu, u16 operand) { // BIT 3, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->c;
+	alu8_update(&emu->cpu, src, 0x08, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_5A(Emulator* emu, u16 operand) { // BIT 3, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->d;
+	alu8_update(&emu->cpu, src, 0x08, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_5B(Emulator* emu, u16 operand) { // BIT 3, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->e;
+	alu8_update(&emu->cpu, src, 0x08, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_5C(Emulator* emu, u16 operand) { // BIT 3, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->h;
+	alu8_update(&emu->cpu, src, 0x08, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_5D(Emulator* emu, u16 operand) { // BIT 3, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->l;
+	alu8_update(&emu->cpu, src, 0x08, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_5E(Emulator* emu, u16 operand) { // BIT 3, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = read8(emu, r->hl);
+	alu8_update(&emu->cpu, src, 0x08, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_5F(Emulator* emu, u16 operand) { // BIT 3, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->a;
+	alu8_update(&emu->cpu, src, 0x08, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_60(Emulator* emu, u16 operand) { // BIT 4, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->b;
+	alu8_update(&emu->cpu, src, 0x10, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_61(Emulator* emu, u16 operand) { // BIT 4, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->c;
+	alu8_update(&emu->cpu, src, 0x10, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_62(Emulator* emu, u16 operand) { // BIT 4, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->d;
+	alu8_update(&emu->cpu, src, 0x10, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_63(Emulator* emu, u16 operand) { // BIT 4, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->e;
+	alu8_update(&emu->cpu, src, 0x10, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_64(Emulator* emu, u16 operand) { // BIT 4, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->h;
+	alu8_update(&emu->cpu, src, 0x10, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_65(Emulator* emu, u16 operand) { // BIT 4, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->l;
+	alu8_update(&emu->cpu, src, 0x10, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_66(Emulator* emu, u16 operand) { // BIT 4, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = read8(emu, r->hl);
+	alu8_update(&emu->cpu, src, 0x10, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_67(Emulator* emu, u16 operand) { // BIT 4, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->a;
+	alu8_update(&emu->cpu, src, 0x10, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_68(Emulator* emu, u16 operand) { // BIT 5, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->b;
+	alu8_update(&emu->cpu, src, 0x20, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_69(Emulator* emu, u16 operand) { // BIT 5, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->c;
+	alu8_update(&emu->cpu, src, 0x20, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_6A(Emulator* emu, u16 operand) { // BIT 5, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->d;
+	alu8_update(&emu->cpu, src, 0x20, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_6B(Emulator* emu, u16 operand) { // BIT 5, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->e;
+	alu8_update(&emu->cpu, src, 0x20, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_6C(Emulator* emu, u16 operand) { // BIT 5, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->h;
+	alu8_update(&emu->cpu, src, 0x20, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_6D(Emulator* emu, u16 operand) { // BIT 5, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->l;
+	alu8_update(&emu->cpu, src, 0x20, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_6E(Emulator* emu, u16 operand) { // BIT 5, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = read8(emu, r->hl);
+	alu8_update(&emu->cpu, src, 0x20, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_6F(Emulator* emu, u16 operand) { // BIT 5, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->a;
+	alu8_update(&emu->cpu, src, 0x20, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_70(Emulator* emu, u16 operand) { // BIT 6, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->b;
+	alu8_update(&emu->cpu, src, 0x40, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_71(Emulator* emu, u16 operand) { // BIT 6, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->c;
+	alu8_update(&emu->cpu, src, 0x40, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_72(Emulator* emu, u16 operand) { // BIT 6, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->d;
+	alu8_update(&emu->cpu, src, 0x40, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_73(Emulator* emu, u16 operand) { // BIT 6, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->e;
+	alu8_update(&emu->cpu, src, 0x40, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_74(Emulator* emu, u16 operand) { // BIT 6, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->h;
+	alu8_update(&emu->cpu, src, 0x40, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_75(Emulator* emu, u16 operand) { // BIT 6, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->l;
+	alu8_update(&emu->cpu, src, 0x40, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_76(Emulator* emu, u16 operand) { // BIT 6, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = read8(emu, r->hl);
+	alu8_update(&emu->cpu, src, 0x40, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_77(Emulator* emu, u16 operand) { // BIT 6, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->a;
+	alu8_update(&emu->cpu, src, 0x40, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_78(Emulator* emu, u16 operand) { // BIT 7, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->b;
+	alu8_update(&emu->cpu, src, 0x80, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_79(Emulator* emu, u16 operand) { // BIT 7, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->c;
+	alu8_update(&emu->cpu, src, 0x80, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_7A(Emulator* emu, u16 operand) { // BIT 7, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->d;
+	alu8_update(&emu->cpu, src, 0x80, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_7B(Emulator* emu, u16 operand) { // BIT 7, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->e;
+	alu8_update(&emu->cpu, src, 0x80, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_7C(Emulator* emu, u16 operand) { // BIT 7, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->h;
+	alu8_update(&emu->cpu, src, 0x80, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_7D(Emulator* emu, u16 operand) { // BIT 7, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->l;
+	alu8_update(&emu->cpu, src, 0x80, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_7E(Emulator* emu, u16 operand) { // BIT 7, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = read8(emu, r->hl);
+	alu8_update(&emu->cpu, src, 0x80, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_7F(Emulator* emu, u16 operand) { // BIT 7, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = r->a;
+	alu8_update(&emu->cpu, src, 0x80, BIT, 0x20, 0xBF, 0x10);
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_80(Emulator* emu, u16 operand) { // RES 0, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->b;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->b = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_81(Emulator* emu, u16 operand) { // RES 0, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->c;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->c = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_82(Emulator* emu, u16 operand) { // RES 0, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->d;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->d = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_83(Emulator* emu, u16 operand) { // RES 0, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->e;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->e = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_84(Emulator* emu, u16 operand) { // RES 0, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->h;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->h = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_85(Emulator* emu, u16 operand) { // RES 0, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->l;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->l = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_86(Emulator* emu, u16 operand) { // RES 0, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = read8(emu, r->hl);
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	write8(emu, r->hl, result);
+	return (Cycles) { 2, 16 };
+}
+
+static Cycles cb_87(Emulator* emu, u16 operand) { // RES 0, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->a = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_88(Emulator* emu, u16 operand) { // RES 1, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x01;
+	u8 dst = r->b;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->b = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_89(Emulator* emu, u16 operand) { // RES 1, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x01;
+	u8 dst = r->c;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->c = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_8A(Emulator* emu, u16 operand) { // RES 1, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x01;
+	u8 dst = r->d;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->d = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_8B(Emulator* emu, u16 operand) { // RES 1, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x01;
+	u8 dst = r->e;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->e = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_8C(Emulator* emu, u16 operand) { // RES 1, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x01;
+	u8 dst = r->h;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->h = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_8D(Emulator* emu, u16 operand) { // RES 1, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x01;
+	u8 dst = r->l;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->l = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_8E(Emulator* emu, u16 operand) { // RES 1, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x01;
+	u8 dst = read8(emu, r->hl);
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	write8(emu, r->hl, result);
+	return (Cycles) { 2, 16 };
+}
+
+static Cycles cb_8F(Emulator* emu, u16 operand) { // RES 1, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x01;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->a = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_90(Emulator* emu, u16 operand) { // RES 2, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x02;
+	u8 dst = r->b;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->b = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_91(Emulator* emu, u16 operand) { // RES 2, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x02;
+	u8 dst = r->c;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->c = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_92(Emulator* emu, u16 operand) { // RES 2, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x02;
+	u8 dst = r->d;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->d = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_93(Emulator* emu, u16 operand) { // RES 2, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x02;
+	u8 dst = r->e;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->e = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_94(Emulator* emu, u16 operand) { // RES 2, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x02;
+	u8 dst = r->h;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->h = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_95(Emulator* emu, u16 operand) { // RES 2, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x02;
+	u8 dst = r->l;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->l = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_96(Emulator* emu, u16 operand) { // RES 2, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x02;
+	u8 dst = read8(emu, r->hl);
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	write8(emu, r->hl, result);
+	return (Cycles) { 2, 16 };
+}
+
+static Cycles cb_97(Emulator* emu, u16 operand) { // RES 2, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x02;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->a = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_98(Emulator* emu, u16 operand) { // RES 3, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x03;
+	u8 dst = r->b;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->b = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_99(Emulator* emu, u16 operand) { // RES 3, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x03;
+	u8 dst = r->c;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->c = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_9A(Emulator* emu, u16 operand) { // RES 3, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x03;
+	u8 dst = r->d;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->d = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_9B(Emulator* emu, u16 operand) { // RES 3, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x03;
+	u8 dst = r->e;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->e = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_9C(Emulator* emu, u16 operand) { // RES 3, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x03;
+	u8 dst = r->h;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->h = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_9D(Emulator* emu, u16 operand) { // RES 3, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x03;
+	u8 dst = r->l;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->l = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_9E(Emulator* emu, u16 operand) { // RES 3, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x03;
+	u8 dst = read8(emu, r->hl);
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	write8(emu, r->hl, result);
+	return (Cycles) { 2, 16 };
+}
+
+static Cycles cb_9F(Emulator* emu, u16 operand) { // RES 3, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x03;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->a = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_A0(Emulator* emu, u16 operand) { // RES 4, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x04;
+	u8 dst = r->b;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->b = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_A1(Emulator* emu, u16 operand) { // RES 4, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x04;
+	u8 dst = r->c;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->c = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_A2(Emulator* emu, u16 operand) { // RES 4, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x04;
+	u8 dst = r->d;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->d = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_A3(Emulator* emu, u16 operand) { // RES 4, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x04;
+	u8 dst = r->e;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->e = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_A4(Emulator* emu, u16 operand) { // RES 4, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x04;
+	u8 dst = r->h;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->h = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_A5(Emulator* emu, u16 operand) { // RES 4, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x04;
+	u8 dst = r->l;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->l = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_A6(Emulator* emu, u16 operand) { // RES 4, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x04;
+	u8 dst = read8(emu, r->hl);
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	write8(emu, r->hl, result);
+	return (Cycles) { 2, 16 };
+}
+
+static Cycles cb_A7(Emulator* emu, u16 operand) { // RES 4, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x04;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->a = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_A8(Emulator* emu, u16 operand) { // RES 5, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x05;
+	u8 dst = r->b;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->b = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_A9(Emulator* emu, u16 operand) { // RES 5, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x05;
+	u8 dst = r->c;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->c = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_AA(Emulator* emu, u16 operand) { // RES 5, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x05;
+	u8 dst = r->d;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->d = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_AB(Emulator* emu, u16 operand) { // RES 5, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x05;
+	u8 dst = r->e;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->e = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_AC(Emulator* emu, u16 operand) { // RES 5, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x05;
+	u8 dst = r->h;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->h = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_AD(Emulator* emu, u16 operand) { // RES 5, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x05;
+	u8 dst = r->l;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->l = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_AE(Emulator* emu, u16 operand) { // RES 5, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x05;
+	u8 dst = read8(emu, r->hl);
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	write8(emu, r->hl, result);
+	return (Cycles) { 2, 16 };
+}
+
+static Cycles cb_AF(Emulator* emu, u16 operand) { // RES 5, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x05;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->a = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_B0(Emulator* emu, u16 operand) { // RES 6, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x06;
+	u8 dst = r->b;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->b = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_B1(Emulator* emu, u16 operand) { // RES 6, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x06;
+	u8 dst = r->c;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->c = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_B2(Emulator* emu, u16 operand) { // RES 6, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x06;
+	u8 dst = r->d;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->d = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_B3(Emulator* emu, u16 operand) { // RES 6, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x06;
+	u8 dst = r->e;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->e = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_B4(Emulator* emu, u16 operand) { // RES 6, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x06;
+	u8 dst = r->h;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->h = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_B5(Emulator* emu, u16 operand) { // RES 6, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x06;
+	u8 dst = r->l;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->l = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_B6(Emulator* emu, u16 operand) { // RES 6, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x06;
+	u8 dst = read8(emu, r->hl);
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	write8(emu, r->hl, result);
+	return (Cycles) { 2, 16 };
+}
+
+static Cycles cb_B7(Emulator* emu, u16 operand) { // RES 6, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x06;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->a = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_B8(Emulator* emu, u16 operand) { // RES 7, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x07;
+	u8 dst = r->b;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->b = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_B9(Emulator* emu, u16 operand) { // RES 7, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x07;
+	u8 dst = r->c;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->c = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_BA(Emulator* emu, u16 operand) { // RES 7, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x07;
+	u8 dst = r->d;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->d = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_BB(Emulator* emu, u16 operand) { // RES 7, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x07;
+	u8 dst = r->e;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->e = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_BC(Emulator* emu, u16 operand) { // RES 7, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x07;
+	u8 dst = r->h;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->h = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_BD(Emulator* emu, u16 operand) { // RES 7, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x07;
+	u8 dst = r->l;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->l = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_BE(Emulator* emu, u16 operand) { // RES 7, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x07;
+	u8 dst = read8(emu, r->hl);
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	write8(emu, r->hl, result);
+	return (Cycles) { 2, 16 };
+}
+
+static Cycles cb_BF(Emulator* emu, u16 operand) { // RES 7, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x07;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, RES, 0x00, 0xFF, 0xF0);
+	r->a = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_C0(Emulator* emu, u16 operand) { // SET 0, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->b;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->b = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_C1(Emulator* emu, u16 operand) { // SET 0, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->c;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->c = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_C2(Emulator* emu, u16 operand) { // SET 0, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->d;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->d = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_C3(Emulator* emu, u16 operand) { // SET 0, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->e;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->e = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_C4(Emulator* emu, u16 operand) { // SET 0, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->h;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->h = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_C5(Emulator* emu, u16 operand) { // SET 0, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->l;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->l = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_C6(Emulator* emu, u16 operand) { // SET 0, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = read8(emu, r->hl);
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	write8(emu, r->hl, result);
+	return (Cycles) { 2, 16 };
+}
+
+static Cycles cb_C7(Emulator* emu, u16 operand) { // SET 0, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x00;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->a = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_C8(Emulator* emu, u16 operand) { // SET 1, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x01;
+	u8 dst = r->b;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->b = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_C9(Emulator* emu, u16 operand) { // SET 1, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x01;
+	u8 dst = r->c;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->c = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_CA(Emulator* emu, u16 operand) { // SET 1, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x01;
+	u8 dst = r->d;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->d = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_CB(Emulator* emu, u16 operand) { // SET 1, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x01;
+	u8 dst = r->e;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->e = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_CC(Emulator* emu, u16 operand) { // SET 1, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x01;
+	u8 dst = r->h;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->h = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_CD(Emulator* emu, u16 operand) { // SET 1, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x01;
+	u8 dst = r->l;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->l = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_CE(Emulator* emu, u16 operand) { // SET 1, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x01;
+	u8 dst = read8(emu, r->hl);
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	write8(emu, r->hl, result);
+	return (Cycles) { 2, 16 };
+}
+
+static Cycles cb_CF(Emulator* emu, u16 operand) { // SET 1, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x01;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->a = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_D0(Emulator* emu, u16 operand) { // SET 2, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x02;
+	u8 dst = r->b;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->b = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_D1(Emulator* emu, u16 operand) { // SET 2, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x02;
+	u8 dst = r->c;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->c = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_D2(Emulator* emu, u16 operand) { // SET 2, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x02;
+	u8 dst = r->d;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->d = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_D3(Emulator* emu, u16 operand) { // SET 2, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x02;
+	u8 dst = r->e;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->e = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_D4(Emulator* emu, u16 operand) { // SET 2, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x02;
+	u8 dst = r->h;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->h = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_D5(Emulator* emu, u16 operand) { // SET 2, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x02;
+	u8 dst = r->l;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->l = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_D6(Emulator* emu, u16 operand) { // SET 2, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x02;
+	u8 dst = read8(emu, r->hl);
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	write8(emu, r->hl, result);
+	return (Cycles) { 2, 16 };
+}
+
+static Cycles cb_D7(Emulator* emu, u16 operand) { // SET 2, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x02;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->a = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_D8(Emulator* emu, u16 operand) { // SET 3, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x03;
+	u8 dst = r->b;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->b = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_D9(Emulator* emu, u16 operand) { // SET 3, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x03;
+	u8 dst = r->c;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->c = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_DA(Emulator* emu, u16 operand) { // SET 3, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x03;
+	u8 dst = r->d;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->d = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_DB(Emulator* emu, u16 operand) { // SET 3, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x03;
+	u8 dst = r->e;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->e = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_DC(Emulator* emu, u16 operand) { // SET 3, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x03;
+	u8 dst = r->h;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->h = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_DD(Emulator* emu, u16 operand) { // SET 3, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x03;
+	u8 dst = r->l;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->l = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_DE(Emulator* emu, u16 operand) { // SET 3, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x03;
+	u8 dst = read8(emu, r->hl);
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	write8(emu, r->hl, result);
+	return (Cycles) { 2, 16 };
+}
+
+static Cycles cb_DF(Emulator* emu, u16 operand) { // SET 3, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x03;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->a = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_E0(Emulator* emu, u16 operand) { // SET 4, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x04;
+	u8 dst = r->b;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->b = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_E1(Emulator* emu, u16 operand) { // SET 4, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x04;
+	u8 dst = r->c;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->c = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_E2(Emulator* emu, u16 operand) { // SET 4, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x04;
+	u8 dst = r->d;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->d = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_E3(Emulator* emu, u16 operand) { // SET 4, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x04;
+	u8 dst = r->e;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->e = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_E4(Emulator* emu, u16 operand) { // SET 4, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x04;
+	u8 dst = r->h;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->h = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_E5(Emulator* emu, u16 operand) { // SET 4, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x04;
+	u8 dst = r->l;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->l = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_E6(Emulator* emu, u16 operand) { // SET 4, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x04;
+	u8 dst = read8(emu, r->hl);
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	write8(emu, r->hl, result);
+	return (Cycles) { 2, 16 };
+}
+
+static Cycles cb_E7(Emulator* emu, u16 operand) { // SET 4, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x04;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->a = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_E8(Emulator* emu, u16 operand) { // SET 5, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x05;
+	u8 dst = r->b;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->b = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_E9(Emulator* emu, u16 operand) { // SET 5, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x05;
+	u8 dst = r->c;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->c = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_EA(Emulator* emu, u16 operand) { // SET 5, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x05;
+	u8 dst = r->d;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->d = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_EB(Emulator* emu, u16 operand) { // SET 5, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x05;
+	u8 dst = r->e;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->e = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_EC(Emulator* emu, u16 operand) { // SET 5, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x05;
+	u8 dst = r->h;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->h = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_ED(Emulator* emu, u16 operand) { // SET 5, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x05;
+	u8 dst = r->l;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->l = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_EE(Emulator* emu, u16 operand) { // SET 5, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x05;
+	u8 dst = read8(emu, r->hl);
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	write8(emu, r->hl, result);
+	return (Cycles) { 2, 16 };
+}
+
+static Cycles cb_EF(Emulator* emu, u16 operand) { // SET 5, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x05;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->a = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_F0(Emulator* emu, u16 operand) { // SET 6, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x06;
+	u8 dst = r->b;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->b = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_F1(Emulator* emu, u16 operand) { // SET 6, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x06;
+	u8 dst = r->c;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->c = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_F2(Emulator* emu, u16 operand) { // SET 6, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x06;
+	u8 dst = r->d;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->d = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_F3(Emulator* emu, u16 operand) { // SET 6, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x06;
+	u8 dst = r->e;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->e = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_F4(Emulator* emu, u16 operand) { // SET 6, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x06;
+	u8 dst = r->h;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->h = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_F5(Emulator* emu, u16 operand) { // SET 6, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x06;
+	u8 dst = r->l;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->l = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_F6(Emulator* emu, u16 operand) { // SET 6, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x06;
+	u8 dst = read8(emu, r->hl);
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	write8(emu, r->hl, result);
+	return (Cycles) { 2, 16 };
+}
+
+static Cycles cb_F7(Emulator* emu, u16 operand) { // SET 6, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x06;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->a = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_F8(Emulator* emu, u16 operand) { // SET 7, B
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x07;
+	u8 dst = r->b;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->b = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_F9(Emulator* emu, u16 operand) { // SET 7, C
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x07;
+	u8 dst = r->c;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->c = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_FA(Emulator* emu, u16 operand) { // SET 7, D
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x07;
+	u8 dst = r->d;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->d = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_FB(Emulator* emu, u16 operand) { // SET 7, E
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x07;
+	u8 dst = r->e;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->e = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_FC(Emulator* emu, u16 operand) { // SET 7, H
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x07;
+	u8 dst = r->h;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->h = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_FD(Emulator* emu, u16 operand) { // SET 7, L
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x07;
+	u8 dst = r->l;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->l = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles cb_FE(Emulator* emu, u16 operand) { // SET 7, (HL)
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x07;
+	u8 dst = read8(emu, r->hl);
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	write8(emu, r->hl, result);
+	return (Cycles) { 2, 16 };
+}
+
+static Cycles cb_FF(Emulator* emu, u16 operand) { // SET 7, A
+	Registers* r = &emu->cpu.registers;
+	u8 src = 0x07;
+	u8 dst = r->a;
+	u8 result = alu8_update(&emu->cpu, dst, src, SET_OP, 0x00, 0xFF, 0xF0);
+	r->a = result;
+	return (Cycles) { 2, 8 };
+}
+
+static Cycles fused_2A_12_13(Emulator* emu, const MicroOp* ops) { // LD A, (HL+) / LD (DE), A / INC DE
+	Cycles c = op_2A(emu, ops[0].operand);
+	if (!continue_fusion(emu, &ops[1], &c)) {
+		return c;
+	}
+	c = op_12(emu, ops[1].operand);
+	if (!continue_fusion(emu, &ops[2], &c)) {
+		return c;
+	}
+	return op_13(emu, ops[2].operand);
+}
+
+static Cycles fused_1A_22_13(Emulator* emu, const MicroOp* ops) { // LD A, (DE) / LD (HL+), A / INC DE
+	Cycles c = op_1A(emu, ops[0].operand);
+	if (!continue_fusion(emu, &ops[1], &c)) {
+		return c;
+	}
+	c = op_22(emu, ops[1].operand);
+	if (!continue_fusion(emu, &ops[2], &c)) {
+		return c;
+	}
+	return op_13(emu, ops[2].operand);
+}
+
+static Cycles fused_F0_FE_20(Emulator* emu, const MicroOp* ops) { // LD A, (FF00 + u8) / CP A, u8 / JR NZ, i8
+	Cycles c = op_F0(emu, ops[0].operand);
+	if (!continue_fusion(emu, &ops[1], &c)) {
+		return c;
+	}
+	c = op_FE(emu, ops[1].operand);
+	if (!continue_fusion(emu, &ops[2], &c)) {
+		return c;
+	}
+	return op_20(emu, ops[2].operand);
+}
+
+static Cycles fused_F0_FE_28(Emulator* emu, const MicroOp* ops) { // LD A, (FF00 + u8) / CP A, u8 / JR Z, i8
+	Cycles c = op_F0(emu, ops[0].operand);
+	if (!continue_fusion(emu, &ops[1], &c)) {
+		return c;
+	}
+	c = op_FE(emu, ops[1].operand);
+	if (!continue_fusion(emu, &ops[2], &c)) {
+		return c;
+	}
+	return op_28(emu, ops[2].operand);
+}
+
+static Cycles fused_F0_FE_30(Emulator* emu, const MicroOp* ops) { // LD A, (FF00 + u8) / CP A, u8 / JR NC, i8
+	Cycles c = op_F0(emu, ops[0].operand);
+	if (!continue_fusion(emu, &ops[1], &c)) {
+		return c;
+	}
+	c = op_FE(emu, ops[1].operand);
+	if (!continue_fusion(emu, &ops[2], &c)) {
+		return c;
+	}
+	return op_30(emu, ops[2].operand);
+}
+
+static Cycles fused_F0_FE_38(Emulator* emu, const MicroOp* ops) { // LD A, (FF00 + u8) / CP A, u8 / JR C, i8
+	Cycles c = op_F0(emu, ops[0].operand);
+	if (!continue_fusion(emu, &ops[1], &c)) {
+		return c;
+	}
+	c = op_FE(emu, ops[1].operand);
+	if (!continue_fusion(emu, &ops[2], &c)) {
+		return c;
+	}
+	return op_38(emu, ops[2].operand);
+}
+
+static Cycles fused_78_B1_20(Emulator* emu, const MicroOp* ops) { // LD A, B / OR A, C / JR NZ, i8
+	Cycles c = op_78(emu, ops[0].operand);
+	if (!continue_fusion(emu, &ops[1], &c)) {
+		return c;
+	}
+	c = op_B1(emu, ops[1].operand);
+	if (!continue_fusion(emu, &ops[2], &c)) {
+		return c;
+	}
+	return op_20(emu, ops[2].operand);
+}
+
+static Cycles fused_F0_FE(Emulator* emu, const MicroOp* ops) { // LD A, (FF00 + u8) / CP A, u8
+	Cycles c = op_F0(emu, ops[0].operand);
+	if (!continue_fusion(emu, &ops[1], &c)) {
+		return c;
+	}
+	return op_FE(emu, ops[1].operand);
+}
+
+static Cycles fused_F0_E6(Emulator* emu, const MicroOp* ops) { // LD A, (FF00 + u8) / AND A, u8
+	Cycles c = op_F0(emu, ops[0].operand);
+	if (!continue_fusion(emu, &ops[1], &c)) {
+		return c;
+	}
+	return op_E6(emu, ops[1].operand);
+}
+
+static Cycles fused_FE_20(Emulator* emu, const MicroOp* ops) { // CP A, u8 / JR NZ, i8
+	Cycles c = op_FE(emu, ops[0].operand);
+	if (!continue_fusion(emu, &ops[1], &c)) {
+		return c;
+	}
+	return op_20(emu, ops[1].operand);
+}
+
+static Cycles fused_FE_28(Emulator* emu, const MicroOp* ops) { // CP A, u8 / JR Z, i8
+	Cycles c = op_FE(emu, ops[0].operand);
+	if (!continue_fusion(emu, &ops[1], &c)) {
+		return c;
+	}
+	return op_28(emu, ops[1].operand);
+}
+
+static Cycles fused_A7_20(Emulator* emu, const MicroOp* ops) { // AND A, A / JR NZ, i8
+	Cycles c = op_A7(emu, ops[0].operand);
+	if (!continue_fusion(emu, &ops[1], &c)) {
+		return c;
+	}
+	return op_20(emu, ops[1].operand);
+}
+
+static Cycles fused_A7_28(Emulator* emu, const MicroOp* ops) { // AND A, A / JR Z, i8
+	Cycles c = op_A7(emu, ops[0].operand);
+	if (!continue_fusion(emu, &ops[1], &c)) {
+		return c;
+	}
+	return op_28(emu, ops[1].operand);
+}
+
+static Cycles fused_22_0B(Emulator* emu, const MicroOp* ops) { // LD (HL+), A / DEC BC
+	Cycles c = op_22(emu, ops[0].operand);
+	if (!continue_fusion(emu, &ops[1], &c)) {
+		return c;
+	}
+	return op_0B(emu, ops[1].operand);
+}
+
+static Cycles fused_0B_78(Emulator* emu, const MicroOp* ops) { // DEC BC / LD A, B
+	Cycles c = op_0B(emu, ops[0].operand);
+	if (!continue_fusion(emu, &ops[1], &c)) {
+		return c;
+	}
+	return op_78(emu, ops[1].operand);
+}
+
+static Cycles fused_05_20(Emulator* emu, const MicroOp* ops) { // DEC B / JR NZ, i8
+	Cycles c = op_05(emu, ops[0].operand);
+	if (!continue_fusion(emu, &ops[1], &c)) {
+		return c;
+	}
+	return op_20(emu, ops[1].operand);
+}
+
+static Cycles fused_0D_20(Emulator* emu, const MicroOp* ops) { // DEC C / JR NZ, i8
+	Cycles c = op_0D(emu, ops[0].operand);
+	if (!continue_fusion(emu, &ops[1], &c)) {
+		return c;
+	}
+	return op_20(emu, ops[1].operand);
+}
+
+static Cycles fused_15_20(Emulator* emu, const MicroOp* ops) { // DEC D / JR NZ, i8
+	Cycles c = op_15(emu, ops[0].operand);
+	if (!continue_fusion(emu, &ops[1], &c)) {
+		return c;
+	}
+	return op_20(emu, ops[1].operand);
+}
+
+static Cycles fused_1D_20(Emulator* emu, const MicroOp* ops) { // DEC E / JR NZ, i8
+	Cycles c = op_1D(emu, ops[0].operand);
+	if (!continue_fusion(emu, &ops[1], &c)) {
+		return c;
+	}
+	return op_20(emu, ops[1].operand);
+}
+
+static Cycles fused_25_20(Emulator* emu, const MicroOp* ops) { // DEC H / JR NZ, i8
+	Cycles c = op_25(emu, ops[0].operand);
+	if (!continue_fusion(emu, &ops[1], &c)) {
+		return c;
+	}
+	return op_20(emu, ops[1].operand);
+}
+
+static Cycles fused_2D_20(Emulator* emu, const MicroOp* ops) { // DEC L / JR NZ, i8
+	Cycles c = op_2D(emu, ops[0].operand);
+	if (!continue_fusion(emu, &ops[1], &c)) {
+		return c;
+	}
+	return op_20(emu, ops[1].operand);
+}
+
+static Cycles fused_3D_20(Emulator* emu, const MicroOp* ops) { // DEC A / JR NZ, i8
+	Cycles c = op_3D(emu, ops[0].operand);
+	if (!continue_fusion(emu, &ops[1], &c)) {
+		return c;
+	}
+	return op_20(emu, ops[1].operand);
+}
+
+const fast_handler fast_handlers[0x100] = {
+	op_00, op_01, op_02, op_03, op_04, op_05, op_06, op_07,
+	op_08, op_09, op_0A, op_0B, op_0C, op_0D, op_0E, op_0F,
+	op_10, op_11, op_12, op_13, op_14, op_15, op_16, op_17,
+	op_18, op_19, op_1A, op_1B, op_1C, op_1D, op_1E, op_1F,
+	op_20, op_21, op_22, op_23, op_24, op_25, op_26, op_27,
+	op_28, op_29, op_2A, op_2B, op_2C, op_2D, op_2E, op_2F,
+	op_30, op_31, op_32, op_33, op_34, op_35, op_36, op_37,
+	op_38, op_39, op_3A, op_3B, op_3C, op_3D, op_3E, op_3F,
+	op_40, op_41, op_42, op_43, op_44, op_45, op_46, op_47,
+	op_48, op_49, op_4A, op_4B, op_4C, op_4D, op_4E, op_4F,
+	op_50, op_51, op_52, op_53, op_54, op_55, op_56, op_57,
+	op_58, op_59, op_5A, op_5B, op_5C, op_5D, op_5E, op_5F,
+	op_60, op_61, op_62, op_63, op_64, op_65, op_66, op_67,
+	op_68, op_69, op_6A, op_6B, op_6C, op_6D, op_6E, op_6F,
+	op_70, op_71, op_72, op_73, op_74, op_75, op_76, op_77,
+	op_78, op_79, op_7A, op_7B, op_7C, op_7D, op_7E, op_7F,
+	op_80, op_81, op_82, op_83, op_84, op_85, op_86, op_87,
+	op_88, op_89, op_8A, op_8B, op_8C, op_8D, op_8E, op_8F,
+	op_90, op_91, op_92, op_93, op_94, op_95, op_96, op_97,
+	op_98, op_99, op_9A, op_9B, op_9C, op_9D, op_9E, op_9F,
+	op_A0, op_A1, op_A2, op_A3, op_A4, op_A5, op_A6, op_A7,
+	op_A8, op_A9, op_AA, op_AB, op_AC, op_AD, op_AE, op_AF,
+	op_B0, op_B1, op_B2, op_B3, op_B4, op_B5, op_B6, op_B7,
+	op_B8, op_B9, op_BA, op_BB, op_BC, op_BD, op_BE, op_BF,
+	op_C0, op_C1, op_C2, op_C3, op_C4, op_C5, op_C6, op_C7,
+	op_C8, op_C9, op_CA, op_CB, op_CC, op_CD, op_CE, op_CF,
+	op_D0, op_D1, op_D2, op_D3, op_D4, op_D5, op_D6, op_D7,
+	op_D8, op_D9, op_DA, op_DB, op_DC, op_DD, op_DE, op_DF,
+	op_E0, op_E1, op_E2, op_E3, op_E4, op_E5, op_E6, op_E7,
+	op_E8, op_E9, op_EA, op_EB, op_EC, op_ED, op_EE, op_EF,
+	op_F0, op_F1, op_F2, op_F3, op_F4, op_F5, op_F6, op_F7,
+	op_F8, op_F9, op_FA, op_FB, op_FC, op_FD, op_FE, op_FF,
+};
+
+const fast_handler fast_cb_handlers[0x100] = {
+	cb_00, cb_01, cb_02, cb_03, cb_04, cb_05, cb_06, cb_07,
+	cb_08, cb_09, cb_0A, cb_0B, cb_0C, cb_0D, cb_0E, cb_0F,
+	cb_10, cb_11, cb_12, cb_13, cb_14, cb_15, cb_16, cb_17,
+	cb_18, cb_19, cb_1A, cb_1B, cb_1C, cb_1D, cb_1E, cb_1F,
+	cb_20, cb_21, cb_22, cb_23, cb_24, cb_25, cb_26, cb_27,
+	cb_28, cb_29, cb_2A, cb_2B, cb_2C, cb_2D, cb_2E, cb_2F,
+	cb_30, cb_31, cb_32, cb_33, cb_34, cb_35, cb_36, cb_37,
+	cb_38, cb_39, cb_3A, cb_3B, cb_3C, cb_3D, cb_3E, cb_3F,
+	cb_40, cb_41, cb_42, cb_43, cb_44, cb_45, cb_46, cb_47,
+	cb_48, cb_49, cb_4A, cb_4B, cb_4C, cb_4D, cb_4E, cb_4F,
+	cb_50, cb_51, cb_52, cb_53, cb_54, cb_55, cb_56, cb_57,
+	cb_58, cb_59, cb_5A, cb_5B, cb_5C, cb_5D, cb_5E, cb_5F,
+	cb_60, cb_61, cb_62, cb_63, cb_64, cb_65, cb_66, cb_67,
+	cb_68, cb_69, cb_6A, cb_6B, cb_6C, cb_6D, cb_6E, cb_6F,
+	cb_70, cb_71, cb_72, cb_73, cb_74, cb_75, cb_76, cb_77,
+	cb_78, cb_79, cb_7A, cb_7B, cb_7C, cb_7D, cb_7E, cb_7F,
+	cb_80, cb_81, cb_82, cb_83, cb_84, cb_85, cb_86, cb_87,
+	cb_88, cb_89, cb_8A, cb_8B, cb_8C, cb_8D, cb_8E, cb_8F,
+	cb_90, cb_91, cb_92, cb_93, cb_94, cb_95, cb_96, cb_97,
+	cb_98, cb_99, cb_9A, cb_9B, cb_9C, cb_9D, cb_9E, cb_9F,
+	cb_A0, cb_A1, cb_A2, cb_A3, cb_A4, cb_A5, cb_A6, cb_A7,
+	cb_A8, cb_A9, cb_AA, cb_AB, cb_AC, cb_AD, cb_AE, cb_AF,
+	cb_B0, cb_B1, cb_B2, cb_B3, cb_B4, cb_B5, cb_B6, cb_B7,
+	cb_B8, cb_B9, cb_BA, cb_BB, cb_BC, cb_BD, cb_BE, cb_BF,
+	cb_C0, cb_C1, cb_C2, cb_C3, cb_C4, cb_C5, cb_C6, cb_C7,
+	cb_C8, cb_C9, cb_CA, cb_CB, cb_CC, cb_CD, cb_CE, cb_CF,
+	cb_D0, cb_D1, cb_D2, cb_D3, cb_D4, cb_D5, cb_D6, cb_D7,
+	cb_D8, cb_D9, cb_DA, cb_DB, cb_DC, cb_DD, cb_DE, cb_DF,
+	cb_E0, cb_E1, cb_E2, cb_E3, cb_E4, cb_E5, cb_E6, cb_E7,
+	cb_E8, cb_E9, cb_EA, cb_EB, cb_EC, cb_ED, cb_EE, cb_EF,
+	cb_F0, cb_F1, cb_F2, cb_F3, cb_F4, cb_F5, cb_F6, cb_F7,
+	cb_F8, cb_F9, cb_FA, cb_FB, cb_FC, cb_FD, cb_FE, cb_FF,
+};
+
+const u8 instruction_lengths[0x100] = {
+	1, 3, 1, 1, 1, 1, 2, 1, 3, 1, 1, 1, 1, 1, 2, 1,
+	1, 3, 1, 1, 1, 1, 2, 1, 2, 1, 1, 1, 1, 1, 2, 1,
+	2, 3, 1, 1, 1, 1, 2, 1, 2, 1, 1, 1, 1, 1, 2, 1,
+	2, 3, 1, 1, 1, 1, 2, 1, 2, 1, 1, 1, 1, 1, 2, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 3, 3, 3, 1, 2, 1, 1, 1, 3, 2, 3, 3, 2, 1,
+	1, 1, 3, 1, 3, 1, 2, 1, 1, 1, 3, 1, 3, 1, 2, 1,
+	2, 1, 1, 1, 1, 1, 2, 1, 2, 1, 3, 1, 1, 1, 2, 1,
+	2, 1, 1, 1, 1, 1, 2, 1, 2, 1, 3, 1, 1, 1, 2, 1,
+};
+
+const Fusion fusions[] = {
+	{ 3, { 0x2A, 0x12, 0x13 }, fused_2A_12_13, "LD A, (HL+) / LD (DE), A / INC DE" },
+	{ 3, { 0x1A, 0x22, 0x13 }, fused_1A_22_13, "LD A, (DE) / LD (HL+), A / INC DE" },
+	{ 3, { 0xF0, 0xFE, 0x20 }, fused_F0_FE_20, "LD A, (FF00 + u8) / CP A, u8 / JR NZ, i8" },
+	{ 3, { 0xF0, 0xFE, 0x28 }, fused_F0_FE_28, "LD A, (FF00 + u8) / CP A, u8 / JR Z, i8" },
+	{ 3, { 0xF0, 0xFE, 0x30 }, fused_F0_FE_30, "LD A, (FF00 + u8) / CP A, u8 / JR NC, i8" },
+	{ 3, { 0xF0, 0xFE, 0x38 }, fused_F0_FE_38, "LD A, (FF00 + u8) / CP A, u8 / JR C, i8" },
+	{ 3, { 0x78, 0xB1, 0x20 }, fused_78_B1_20, "LD A, B / OR A, C / JR NZ, i8" },
+	{ 2, { 0xF0, 0xFE }, fused_F0_FE, "LD A, (FF00 + u8) / CP A, u8" },
+	{ 2, { 0xF0, 0xE6 }, fused_F0_E6, "LD A, (FF00 + u8) / AND A, u8" },
+	{ 2, { 0xFE, 0x20 }, fused_FE_20, "CP A, u8 / JR NZ, i8" },
+	{ 2, { 0xFE, 0x28 }, fused_FE_28, "CP A, u8 / JR Z, i8" },
+	{ 2, { 0xA7, 0x20 }, fused_A7_20, "AND A, A / JR NZ, i8" },
+	{ 2, { 0xA7, 0x28 }, fused_A7_28, "AND A, A / JR Z, i8" },
+	{ 2, { 0x22, 0x0B }, fused_22_0B, "LD (HL+), A / DEC BC" },
+	{ 2, { 0x0B, 0x78 }, fused_0B_78, "DEC BC / LD A, B" },
+	{ 2, { 0x05, 0x20 }, fused_05_20, "DEC B / JR NZ, i8" },
+	{ 2, { 0x0D, 0x20 }, fused_0D_20, "DEC C / JR NZ, i8" },
+	{ 2, { 0x15, 0x20 }, fused_15_20, "DEC D / JR NZ, i8" },
+	{ 2, { 0x1D, 0x20 }, fused_1D_20, "DEC E / JR NZ, i8" },
+	{ 2, { 0x25, 0x20 }, fused_25_20, "DEC H / JR NZ, i8" },
+	{ 2, { 0x2D, 0x20 }, fused_2D_20, "DEC L / JR NZ, i8" },
+	{ 2, { 0x3D, 0x20 }, fused_3D_20, "DEC A / JR NZ, i8" },
+};
+const int num_fusions = 22;
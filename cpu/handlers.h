@@ -0,0 +1,39 @@
+#pragma once
+#include "../global_definitions.h"
+#include "../mmu/mmu.h"
+#include "fetch.h"
+
+// Per-opcode handlers generated from the operations table by tools/gen_handlers.c. Each one runs a whole
+// instruction and returns its cycles, taken-branch penalties included. The caller has already moved PC past
+// the instruction and passes its immediate (u8, u16 or the CB opcode) in operand.
+typedef Cycles (*fast_handler)(Emulator* emu, u16 operand);
+
+extern const fast_handler fast_handlers[0x100];
+extern const fast_handler fast_cb_handlers[0x100];
+extern const u8 instruction_lengths[0x100];
+
+static inline void advance_pc(Emulator* emu) {
+	++emu->cpu.registers.pc;
+
+	if (emu->cpu.registers.pc == 0x101) {
+		leave_bios(emu);
+	}
+}
+
+static inline u16 read_operand(Emulator* emu, u16 pc, u8 length) {
+	switch (length) {
+	case 2:
+		return fetch8(emu, pc + 1);
+	case 3:
+		return fetch16(emu, pc + 1);
+	default:
+		return 0;
+	}
+}
+
+// Only the opcode byte goes through advance_pc, matching the reference path where immediates are read
+// with a bare pc++.
+static inline void skip_instruction(Emulator* emu, u8 length) {
+	advance_pc(emu);
+	emu->cpu.registers.pc += length - 1;
+}
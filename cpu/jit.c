@@ -0,0 +1,741 @@
+// for MAP_ANONYMOUS under a strict -std=c11
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "jit.h"
+
+#ifdef JIT_AVAILABLE
+
+#include <sys/mman.h>
+#include <unistd.h>
+#include "cpu.h"
+#include "block_cache.h"
+#include "operations.h"
+#include "native.h"
+#include "../emulator.h"
+
+// Each block is its two cycle tables (see compile_block) followed by its code.
+#define MAX_NATIVE_SIZE (2 * MAX_BLOCK_OPS + 64 + MAX_BLOCK_OPS * 384)
+
+struct _jit {
+	u8* code;
+	size_t used;
+	size_t page_size;
+};
+
+#ifdef ENABLE_LAZY_FLAGS
+static const bool lazy_flags = true; // handlers can leave cpu.lazy_flags pending
+#else
+static const bool lazy_flags = false;
+#endif
+
+static Jit* create_jit() {
+	Jit* jit = (Jit*)malloc(sizeof(Jit));
+	if (jit == NULL) {
+		return NULL;
+	}
+	jit->code = (u8*)mmap(NULL, JIT_CODE_SIZE, PROT_READ | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (jit->code == MAP_FAILED) {
+		free(jit);
+		return NULL;
+	}
+	jit->used = 0;
+	jit->page_size = (size_t)sysconf(_SC_PAGESIZE);
+	return jit;
+}
+
+// Flips the pages under code[start, start + size) between writable, for compile_block, and executable. The
+// rest of the buffer stays executable.
+static bool set_writable(Jit* jit, size_t start, size_t size, bool writable) {
+	size_t first = start / jit->page_size * jit->page_size;
+	size_t end = start + size < JIT_CODE_SIZE ? start + size : JIT_CODE_SIZE;
+	size_t last = (end + jit->page_size - 1) / jit->page_size * jit->page_size;
+	return mprotect(jit->code + first, last - first, writable ? PROT_READ | PROT_WRITE : PROT_READ | PROT_EXEC) == 0;
+}
+
+void destroy_jit(Jit* jit) {
+	if (jit == NULL) {
+		return;
+	}
+	munmap(jit->code, JIT_CODE_SIZE);
+	free(jit);
+}
+
+typedef struct {
+	u8* p;
+	bool flags_pending; // cpu.lazy_flags may be pending, so registers.f isn't current
+} Emitter;
+
+// Where a native block stands at the instruction being emitted, for the calls that tick the components.
+typedef struct {
+	const u8* cycles; // t-cycles of each instruction
+	int index;
+	u16 next_pc;
+} Site;
+
+enum { RAX, RCX, RDX, RBX, RSP, RBP, RSI, RDI };
+
+static void emit8(Emitter* e, u8 value) {
+	*e->p++ = value;
+}
+
+static void emit16(Emitter* e, u16 value) {
+	memcpy(e->p, &value, 2);
+	e->p += 2;
+}
+
+static void emit32(Emitter* e, u32 value) {
+	memcpy(e->p, &value, 4);
+	e->p += 4;
+}
+
+static void emit64(Emitter* e, uint64_t value) {
+	memcpy(e->p, &value, 8);
+	e->p += 8;
+}
+
+static void emit_bytes(Emitter* e, const u8* bytes, int count) {
+	memcpy(e->p, bytes, count);
+	e->p += count;
+}
+
+#define EMIT(e, ...) do { static const u8 bytes[] = { __VA_ARGS__ }; emit_bytes(e, bytes, sizeof(bytes)); } while (0)
+
+// mov rax, target; call rax
+static void emit_call(Emitter* e, const void* target) {
+	EMIT(e, 0x48, 0xB8);
+	emit64(e, (uint64_t)(uintptr_t)target);
+	EMIT(e, 0xFF, 0xD0);
+}
+
+// mov rdi, rbx
+static void emit_emu_arg(Emitter* e) {
+	EMIT(e, 0x48, 0x89, 0xDF);
+}
+
+// ModRM for [rbx + offset], reg being a register number or an opcode extension.
+static void emit_rbx(Emitter* e, int reg, int offset) {
+	emit8(e, 0x80 | (reg << 3) | RBX);
+	emit32(e, offset);
+}
+
+// mov r8, [rbx + offset]
+static void emit_load8(Emitter* e, int reg, int offset) {
+	emit8(e, 0x8A);
+	emit_rbx(e, reg, offset);
+}
+
+// mov [rbx + offset], r8
+static void emit_store8(Emitter* e, int reg, int offset) {
+	emit8(e, 0x88);
+	emit_rbx(e, reg, offset);
+}
+
+// mov word [rbx + offset], value
+static void emit_store_imm16(Emitter* e, int offset, u16 value) {
+	EMIT(e, 0x66, 0xC7);
+	emit_rbx(e, 0, offset);
+	emit16(e, value);
+}
+
+static void emit_set_pc(Emitter* e, u16 pc) {
+	emit_store_imm16(e, offsetof(Emulator, cpu.registers.pc), pc);
+}
+
+// Returns from the block with the number of instructions it ran in eax.
+static void emit_return(Emitter* e, int result) {
+	emit8(e, 0xB8); // mov eax, result
+	emit32(e, result);
+	EMIT(e, 0x41, 0x5D, 0x41, 0x5C, 0x5B, 0xC3); // pop r13; pop r12; pop rbx; ret
+}
+
+// Short forward jump with opcode op, to be pointed at its target by patch_jump.
+static u8* emit_jump(Emitter* e, u8 op) {
+	emit8(e, op);
+	emit8(e, 0);
+	return e->p;
+}
+
+static void patch_jump(Emitter* e, u8* from) {
+	from[-1] = (u8)(e->p - from);
+}
+
+static int register_offset(operand_type reg) {
+	switch (reg) {
+	case A: return offsetof(Emulator, cpu.registers.a);
+	case B: return offsetof(Emulator, cpu.registers.b);
+	case C: return offsetof(Emulator, cpu.registers.c);
+	case D: return offsetof(Emulator, cpu.registers.d);
+	case E: return offsetof(Emulator, cpu.registers.e);
+	case H: return offsetof(Emulator, cpu.registers.h);
+	case L: return offsetof(Emulator, cpu.registers.l);
+	default: return -1;
+	}
+}
+
+static int register16_offset(operand_type reg) {
+	switch (reg) {
+	case BC: return offsetof(Emulator, cpu.registers.bc);
+	case DE: return offsetof(Emulator, cpu.registers.de);
+	case HL: return offsetof(Emulator, cpu.registers.hl);
+	case SP: return offsetof(Emulator, cpu.registers.sp);
+	default: return -1;
+	}
+}
+
+#define F_OFFSET offsetof(Emulator, cpu.registers.f)
+
+static bool is_pointer(operand_type reg) {
+	return reg == BC || reg == DE || reg == HL;
+}
+
+static bool is_alu(instruction_type type) {
+	switch (type) {
+	case ADD:
+	case ADC:
+	case SUB:
+	case SBC:
+	case AND:
+	case OR:
+	case XOR:
+	case CP:
+		return true;
+	default:
+		return false;
+	}
+}
+
+// Loads, 8-bit ALU ops, INC/DEC and JR/JP to a fixed address are emitted as native code, with memory
+// accessed through the page tables; everything else calls its handler.
+static bool can_inline(const Operation* op) {
+	address_mode dest_mode = op->dest_addr_mode;
+	address_mode source_mode = op->source_addr_mode;
+	switch (op->type) {
+	case NOP:
+		return true;
+	case LD:
+		if (dest_mode == REGISTER && register_offset(op->dest) >= 0) {
+			return (source_mode == REGISTER && register_offset(op->source) >= 0) || source_mode == MEM_READ
+				|| (source_mode == ADDRESS_R16 && is_pointer(op->source)) || source_mode == MEM_READ_ADDR;
+		}
+		if ((dest_mode == ADDRESS_R16 && is_pointer(op->dest)) || dest_mode == MEM_READ_ADDR) {
+			return (source_mode == REGISTER && register_offset(op->source) >= 0) || source_mode == MEM_READ;
+		}
+		return dest_mode == REGISTER16 && register16_offset(op->dest) >= 0 && source_mode == MEM_READ16;
+	case INC:
+	case DEC:
+		return (dest_mode == REGISTER && register_offset(op->dest) >= 0)
+			|| (dest_mode == ADDRESS_R16 && op->dest == HL)
+			|| (dest_mode == REGISTER16 && register16_offset(op->dest) >= 0);
+	case JP:
+		return source_mode == MEM_READ || source_mode == MEM_READ16;
+	default:
+		return is_alu(op->type) && dest_mode == REGISTER && op->dest == A
+			&& ((source_mode == REGISTER && register_offset(op->source) >= 0) || source_mode == MEM_READ
+				|| (source_mode == ADDRESS_R16 && op->source == HL));
+	}
+}
+
+static bool reads_flags(const Operation* op) {
+	return op->type == ADC || op->type == SBC || op->condition != CONDITION_NONE
+		|| ((is_alu(op->type) || op->type == INC || op->type == DEC) && generate_ignore_mask(op->flag_actions) & 0xF0
+			&& op->dest_addr_mode != REGISTER16);
+}
+
+// The most an instruction can take, taken branches and CB ops included.
+static int max_cycles(const MicroOp* uop) {
+	const Operation* op = &operations[uop->opcode];
+	if (op->type == CB) {
+		return op->t_cycles + cb_operations[(u8)uop->operand].t_cycles;
+	}
+	switch (op->secondary) {
+	case ADD_T_4: return op->t_cycles + 4;
+	case ADD_T_12: return op->t_cycles + 12;
+	default: return op->t_cycles;
+	}
+}
+
+// The reads and writes that miss the page tables tick the components up to the instruction first, so I/O
+// sees them as the interpreter would. A write returns true when the block has to hand back after the
+// instruction (see native_write).
+
+static u8 jit_read(Emulator* emu, u16 address, const u8* cycles, int count) {
+	native_ticks(emu, cycles, count);
+	return read8(emu, address);
+}
+
+static bool jit_write(Emulator* emu, u16 address, u8 data, const u8* cycles, int count) {
+	native_ticks(emu, cycles, count);
+	return native_write(emu, address, data);
+}
+
+// After an instruction run through its handler, which ticks it the way step() would: whether the block
+// has to hand back, for native_tick's reasons or because the rest of it, at most rest t-cycles, no longer
+// fits before the next event.
+static bool jit_tick(Emulator* emu, Cycles c, u16 next_pc, int rest) {
+	return native_tick(emu, c, next_pc) || native_budget(emu) <= rest;
+}
+
+// native_ticks for the instructions from r12, the first one not yet ticked, up to site->index.
+static void emit_ticks(Emitter* e, const u8* cycles, int index) {
+	EMIT(e, 0x48, 0xBE); // mov rsi, cycles
+	emit64(e, (uint64_t)(uintptr_t)cycles);
+	EMIT(e, 0x4C, 0x01, 0xE6); // add rsi, r12
+	emit8(e, 0xBA); // mov edx, index
+	emit32(e, index);
+	EMIT(e, 0x44, 0x29, 0xE2); // sub edx, r12d
+	emit_emu_arg(e);
+	emit_call(e, (const void*)native_ticks);
+	EMIT(e, 0x41, 0xBC); // mov r12d, index
+	emit32(e, index);
+}
+
+// The address of a memory operand into esi.
+static void emit_address(Emitter* e, address_mode mode, operand_type reg, u16 operand) {
+	if (mode == MEM_READ_ADDR) {
+		emit8(e, 0xBE); // mov esi, operand
+		emit32(e, operand);
+	}
+	else {
+		EMIT(e, 0x0F, 0xB7); // movzx esi, word [rbx + reg]
+		emit_rbx(e, RSI, register16_offset(reg));
+	}
+}
+
+// mov rax, [rbx + rax * 8 + pages]; test rax, rax with eax = esi >> 8
+static void emit_page(Emitter* e, int pages) {
+	EMIT(e, 0x89, 0xF0, 0xC1, 0xE8, 0x08); // mov eax, esi; shr eax, 8
+	EMIT(e, 0x48, 0x8B, 0x84, 0xC3);
+	emit32(e, pages);
+	EMIT(e, 0x48, 0x85, 0xC0);
+}
+
+// cl = byte at esi
+static void emit_read(Emitter* e, const Site* site) {
+	emit_page(e, offsetof(Emulator, mmu.read_pages));
+	u8* slow = emit_jump(e, 0x74); // jz slow
+	EMIT(e, 0x40, 0x0F, 0xB6, 0xD6); // movzx edx, sil
+	EMIT(e, 0x8A, 0x0C, 0x10); // mov cl, [rax + rdx]
+	u8* done = emit_jump(e, 0xEB);
+	patch_jump(e, slow);
+	emit_set_pc(e, site->next_pc);
+	EMIT(e, 0x48, 0xBA); // mov rdx, cycles
+	emit64(e, (uint64_t)(uintptr_t)site->cycles);
+	EMIT(e, 0x4C, 0x01, 0xE2); // add rdx, r12
+	emit8(e, 0xB9); // mov ecx, index
+	emit32(e, site->index);
+	EMIT(e, 0x44, 0x29, 0xE1); // sub ecx, r12d
+	EMIT(e, 0x41, 0xBC); // mov r12d, index
+	emit32(e, site->index);
+	emit_emu_arg(e);
+	emit_call(e, (const void*)jit_read);
+	EMIT(e, 0x89, 0xC1); // mov ecx, eax
+	patch_jump(e, done);
+}
+
+// byte at esi = dl, setting r13b if the block has to hand back after this instruction
+static void emit_write(Emitter* e, const Site* site) {
+	emit_page(e, offsetof(Emulator, mmu.write_pages));
+	u8* slow = emit_jump(e, 0x74); // jz slow
+	EMIT(e, 0x40, 0x0F, 0xB6, 0xCE); // movzx ecx, sil
+	EMIT(e, 0x88, 0x14, 0x08); // mov [rax + rcx], dl
+	u8* done = emit_jump(e, 0xEB);
+	patch_jump(e, slow);
+	emit_set_pc(e, site->next_pc);
+	EMIT(e, 0x48, 0xB9); // mov rcx, cycles
+	emit64(e, (uint64_t)(uintptr_t)site->cycles);
+	EMIT(e, 0x4C, 0x01, 0xE1); // add rcx, r12
+	EMIT(e, 0x41, 0xB8); // mov r8d, index
+	emit32(e, site->index);
+	EMIT(e, 0x45, 0x29, 0xE0); // sub r8d, r12d
+	EMIT(e, 0x41, 0xBC); // mov r12d, index
+	emit32(e, site->index);
+	emit_emu_arg(e);
+	emit_call(e, (const void*)jit_write);
+	EMIT(e, 0x41, 0x08, 0xC5); // or r13b, al
+	patch_jump(e, done);
+}
+
+// Brings registers.f up to date before an instruction reads it.
+static void emit_sync_flags(Emitter* e) {
+	if (!e->flags_pending) {
+		return;
+	}
+	EMIT(e, 0x48, 0x8D, 0xBB); // lea rdi, [rbx + cpu]
+	emit32(e, offsetof(Emulator, cpu));
+	emit_call(e, (const void*)sync_flags);
+	e->flags_pending = false;
+}
+
+// Writes F from the x86 flags of the last 8-bit add, sub, logic op, inc or dec: ZF, AF and CF are the Game Boy's
+// Z, H and C, and op's flag actions say which of them count.
+static void emit_flags(Emitter* e, const Operation* op) {
+	u8 set = generate_set_mask(op->flag_actions);
+	u8 reset = generate_reset_mask(op->flag_actions);
+	u8 ignore = generate_ignore_mask(op->flag_actions);
+	u8 dependent = 0xF0 & ~set & reset & ~ignore;
+
+	EMIT(e, 0x9F); // lahf
+	EMIT(e, 0x88, 0xE1, 0x88, 0xC8); // mov cl, ah; mov al, cl
+	EMIT(e, 0x24, 0x50, 0x00, 0xC0); // and al, 0x50 (ZF, AF); add al, al
+	EMIT(e, 0x80, 0xE1, 0x01, 0xC0, 0xE1, 0x04); // and cl, 1 (CF); shl cl, 4
+	EMIT(e, 0x08, 0xC8); // or al, cl
+	EMIT(e, 0x24); // and al, dependent
+	emit8(e, dependent);
+	if (set) {
+		EMIT(e, 0x0C); // or al, set
+		emit8(e, set);
+	}
+	if (ignore) {
+		emit_load8(e, RCX, F_OFFSET);
+		EMIT(e, 0x80, 0xE1); // and cl, ignore
+		emit8(e, ignore);
+		EMIT(e, 0x08, 0xC8); // or al, cl
+	}
+	if (reset != 0xFF) {
+		EMIT(e, 0x24); // and al, reset
+		emit8(e, reset);
+	}
+	emit_store8(e, RAX, F_OFFSET);
+	if (e->flags_pending) {
+		EMIT(e, 0xC6); // mov byte [rbx + pending], 0
+		emit_rbx(e, 0, offsetof(Emulator, cpu.lazy_flags.pending));
+		emit8(e, 0);
+		e->flags_pending = false;
+	}
+}
+
+static void emit_step16(Emitter* e, operand_type reg, bool increment) {
+	EMIT(e, 0x66, 0xFF); // inc/dec word [rbx + reg]
+	emit_rbx(e, increment ? 0 : 1, register16_offset(reg));
+}
+
+static void emit_secondary(Emitter* e, const Operation* op) {
+	switch (op->secondary) {
+	case INC_R_1: emit_step16(e, op->dest, true); break;
+	case DEC_R_1: emit_step16(e, op->dest, false); break;
+	case INC_R_2: emit_step16(e, op->source, true); break;
+	case DEC_R_2: emit_step16(e, op->source, false); break;
+	default: break;
+	}
+}
+
+// cl = an 8-bit source operand
+static void emit_source(Emitter* e, const Operation* op, const MicroOp* uop, const Site* site) {
+	switch (op->source_addr_mode) {
+	case REGISTER:
+		emit_load8(e, RCX, register_offset(op->source));
+		break;
+	case MEM_READ:
+		emit8(e, 0xB1); // mov cl, operand
+		emit8(e, (u8)uop->operand);
+		break;
+	default:
+		emit_address(e, op->source_addr_mode, op->source, uop->operand);
+		emit_read(e, site);
+		break;
+	}
+}
+
+// Everything but JR/JP, which end the block and are emitted by compile_block. Returns whether the
+// instruction wrote memory, in which case r13b may ask for the block to hand back.
+static bool emit_inline(Emitter* e, const Operation* op, const MicroOp* uop, const Site* site) {
+	static const u8 alu_opcodes[] = { [ADD] = 0x00, [ADC] = 0x10, [SUB] = 0x28, [SBC] = 0x18, [AND] = 0x20, [OR] = 0x08, [XOR] = 0x30, [CP] = 0x38 };
+	if (reads_flags(op)) {
+		emit_sync_flags(e);
+	}
+
+	switch (op->type) {
+	case NOP:
+		return false;
+	case LD:
+		if (op->dest_addr_mode == REGISTER16) {
+			emit_store_imm16(e, register16_offset(op->dest), uop->operand);
+			return false;
+		}
+		if (op->dest_addr_mode == REGISTER) {
+			emit_source(e, op, uop, site);
+			emit_store8(e, RCX, register_offset(op->dest));
+			emit_secondary(e, op);
+			return false;
+		}
+		if (op->source_addr_mode == REGISTER) {
+			emit_load8(e, RDX, register_offset(op->source));
+		}
+		else {
+			emit8(e, 0xB2); // mov dl, operand
+			emit8(e, (u8)uop->operand);
+		}
+		emit_address(e, op->dest_addr_mode, op->dest, uop->operand);
+		emit_write(e, site);
+		emit_secondary(e, op);
+		return true;
+	case INC:
+	case DEC: {
+		u8 step = op->type == INC ? 0xC0 : 0xC8; // inc al / dec al
+		if (op->dest_addr_mode == REGISTER16) {
+			emit_step16(e, op->dest, op->type == INC);
+			return false;
+		}
+		if (op->dest_addr_mode == REGISTER) {
+			emit_load8(e, RAX, register_offset(op->dest));
+			EMIT(e, 0xFE);
+			emit8(e, step);
+			emit_store8(e, RAX, register_offset(op->dest));
+			emit_flags(e, op);
+			return false;
+		}
+		emit_address(e, ADDRESS_R16, HL, 0);
+		emit_read(e, site);
+		EMIT(e, 0x88, 0xC8, 0xFE); // mov al, cl; inc/dec al
+		emit8(e, step);
+		EMIT(e, 0x88, 0xC2); // mov dl, al
+		emit_flags(e, op);
+		emit_address(e, ADDRESS_R16, HL, 0);
+		emit_write(e, site);
+		return true;
+	}
+	default:
+		emit_source(e, op, uop, site);
+		emit_load8(e, RAX, register_offset(A));
+		if (op->type == ADC || op->type == SBC) {
+			emit_load8(e, RDX, F_OFFSET);
+			EMIT(e, 0xC0, 0xEA, 0x05); // shr dl, 5, moving C into CF
+		}
+		emit8(e, alu_opcodes[op->type]); // op al, cl
+		emit8(e, 0xC8);
+		if (op->type != CP) {
+			emit_store8(e, RAX, register_offset(A));
+		}
+		emit_flags(e, op);
+		return false;
+	}
+}
+
+static void reset_code(Jit* jit, BlockCache* cache) {
+	for (int i = 0; i < BLOCK_CACHE_SIZE; ++i) {
+		cache->blocks[i].native = NULL;
+	}
+	jit->used = 0;
+}
+
+// Block code, called as int (*)(Emulator* emu, int budget) with native_budget. It returns 0 without running
+// anything unless the whole block, at its longest, fits in the budget. Otherwise it runs the block, or up to
+// where it has to hand back, and returns how many instructions it got through. Instructions that have a
+// native form keep to registers and the page tables, and their cycles are only handed to native_ticks at the
+// end, before a read or write that misses the page tables, or before the next instruction that goes through
+// its handler. Those are finished and ticked one at a time as step() would.
+//
+// r12 holds the index of the first instruction not yet ticked, r13b is set by a write the block has to
+// stop after. The cycle tables come first, t-cycles per instruction, with the last instruction's branch
+// taken in the second.
+//
+// Returns false, with nothing compiled, if the pages can't be made writable, and true with the JIT left
+// unusable, block->native NULL, if they can't be made executable again.
+static bool compile_block(Jit* jit, BlockCache* cache, Block* block, bool* executable) {
+	*executable = true;
+	if (jit->used + MAX_NATIVE_SIZE > JIT_CODE_SIZE) {
+		reset_code(jit, cache);
+	}
+	if (!set_writable(jit, jit->used, MAX_NATIVE_SIZE, true)) {
+		return false;
+	}
+	u8* start = jit->code + jit->used;
+	u8* cycles = start;
+	u8* taken = start + MAX_BLOCK_OPS;
+	Emitter e = { start + 2 * MAX_BLOCK_OPS, lazy_flags };
+
+	int rest[MAX_BLOCK_OPS + 1]; // at most from each instruction to the end
+	rest[block->num_ops] = 0;
+	for (int i = block->num_ops - 1; i >= 0; --i) {
+		const MicroOp* uop = &block->ops[i];
+		cycles[i] = operations[uop->opcode].t_cycles;
+		taken[i] = i + 1 == block->num_ops ? max_cycles(uop) : cycles[i];
+		rest[i] = rest[i + 1] + max_cycles(uop);
+	}
+
+	u8* code = e.p;
+	EMIT(&e, 0x53, 0x41, 0x54, 0x41, 0x55); // push rbx; push r12; push r13
+	EMIT(&e, 0x48, 0x89, 0xFB); // mov rbx, rdi
+	EMIT(&e, 0x81, 0xFE); // cmp esi, rest[0]
+	emit32(&e, rest[0]);
+	u8* fits = emit_jump(&e, 0x7F); // jg fits
+	emit_return(&e, 0);
+	patch_jump(&e, fits);
+	EMIT(&e, 0x45, 0x31, 0xE4, 0x45, 0x31, 0xED); // xor r12d, r12d; xor r13d, r13d
+
+	u16 pc = block->start_pc;
+	int ticked = 0; // r12 where it's known, -1 otherwise
+	for (int i = 0; i < block->num_ops; ++i) {
+		const MicroOp* uop = &block->ops[i];
+		const Operation* op = &operations[uop->opcode];
+		u16 next_pc = pc + uop->length;
+		bool last = i + 1 == block->num_ops;
+		Site site = { cycles, i, next_pc };
+
+		if (pc == 0x100) { // advance_pc leaving the bios
+			emit_emu_arg(&e);
+			emit_call(&e, (const void*)leave_bios);
+		}
+
+		if (!can_inline(op)) {
+			if (ticked != i) {
+				emit_ticks(&e, cycles, i);
+			}
+			emit_set_pc(&e, next_pc);
+			emit_emu_arg(&e);
+			emit8(&e, 0xBE); // mov esi, operand
+			emit32(&e, uop->operand);
+			emit_call(&e, (const void*)uop->handler);
+			EMIT(&e, 0x48, 0x89, 0xC6); // mov rsi, rax
+			emit_emu_arg(&e);
+			emit8(&e, 0xBA); // mov edx, next_pc
+			emit32(&e, next_pc);
+			if (last) {
+				emit_call(&e, (const void*)native_tick);
+				emit_return(&e, i + 1);
+				break;
+			}
+			emit8(&e, 0xB9); // mov ecx, rest
+			emit32(&e, rest[i + 1]);
+			emit_call(&e, (const void*)jit_tick);
+			EMIT(&e, 0x41, 0xBC); // mov r12d, i + 1
+			emit32(&e, i + 1);
+			EMIT(&e, 0x84, 0xC0); // test al, al
+			u8* go_on = emit_jump(&e, 0x74);
+			emit_return(&e, i + 1);
+			patch_jump(&e, go_on);
+			e.flags_pending = lazy_flags;
+			ticked = i + 1;
+			pc = next_pc;
+			continue;
+		}
+
+		if (op->type == JP) { // always last
+			u16 target = op->source_addr_mode == MEM_READ ? (u16)(next_pc + (i8)uop->operand) : uop->operand;
+			u8* to_target = NULL;
+			if (op->condition != CONDITION_NONE) {
+				emit_sync_flags(&e);
+				u8 flag = op->condition == CONDITION_Z || op->condition == CONDITION_NZ ? FLAG_ZERO : FLAG_CARRY;
+				EMIT(&e, 0xF6); // test byte [rbx + f], flag
+				emit_rbx(&e, 0, F_OFFSET);
+				emit8(&e, flag);
+				EMIT(&e, 0x0F); // jnz/jz taken
+				emit8(&e, op->condition == CONDITION_Z || op->condition == CONDITION_C ? 0x85 : 0x84);
+				to_target = e.p;
+				emit32(&e, 0);
+				emit_set_pc(&e, next_pc);
+				emit_ticks(&e, cycles, i + 1);
+				emit_return(&e, i + 1);
+				u32 rel = (u32)(e.p - (to_target + 4));
+				memcpy(to_target, &rel, 4);
+			}
+			emit_set_pc(&e, target);
+			emit_ticks(&e, taken, i + 1);
+			emit_return(&e, i + 1);
+			break;
+		}
+
+		if (emit_inline(&e, op, uop, &site)) {
+			EMIT(&e, 0x45, 0x84, 0xED); // test r13b, r13b
+			u8* go_on = emit_jump(&e, 0x74);
+			emit_set_pc(&e, next_pc);
+			emit_emu_arg(&e);
+			EMIT(&e, 0x48, 0xBE); // mov rsi, cycles
+			emit64(&e, (u32)op->m_cycles | ((uint64_t)(u32)op->t_cycles << 32));
+			emit8(&e, 0xBA); // mov edx, next_pc
+			emit32(&e, next_pc);
+			emit_call(&e, (const void*)native_tick);
+			emit_return(&e, i + 1);
+			patch_jump(&e, go_on);
+			ticked = -1;
+		}
+		else if (op->source_addr_mode == ADDRESS_R16 || op->source_addr_mode == MEM_READ_ADDR) {
+			ticked = -1; // a read that missed the page tables ticked up to here
+		}
+		if (last) {
+			emit_set_pc(&e, next_pc);
+			emit_ticks(&e, cycles, i + 1);
+			emit_return(&e, i + 1);
+		}
+		pc = next_pc;
+	}
+
+	size_t size = (e.p - start + 15) & ~(size_t)15;
+	if (!set_writable(jit, jit->used, MAX_NATIVE_SIZE, false)) {
+		*executable = false;
+		return true;
+	}
+	block->native = code;
+	jit->used += size;
+	return true;
+}
+
+bool jit_run(Emulator* emu) {
+	BlockCache* cache = emu->cpu.block_cache;
+	if (cache == NULL || tracing(emu)) { // traced code goes through the interpreter
+		return false;
+	}
+	if (emu->cpu.jit == NULL) {
+		emu->cpu.jit = create_jit();
+		if (emu->cpu.jit == NULL) {
+			emu->cpu.dispatch_mode = DISPATCH_BLOCK_CACHE;
+			return false;
+		}
+	}
+
+	u16 pc = emu->cpu.registers.pc;
+	if (cache->current != NULL && pc == cache->next_pc) { // partway through an interpreted block
+		return false;
+	}
+	Block* block = find_block(emu, pc);
+	if (block == NULL) {
+		return false;
+	}
+	if (block->native == NULL) {
+		if (++block->hits < JIT_THRESHOLD) {
+			enter_block(cache, block);
+			return false;
+		}
+		bool executable;
+		if (!compile_block(emu->cpu.jit, cache, block, &executable) || !executable) {
+			// no JIT at all rather than code that can't be run, or a buffer both writable and executable
+			reset_code(emu->cpu.jit, cache);
+			destroy_jit(emu->cpu.jit);
+			emu->cpu.jit = NULL;
+			emu->cpu.dispatch_mode = DISPATCH_BLOCK_CACHE;
+			return false;
+		}
+	}
+
+	cache->current = NULL;
+	cache->entry_generation = cache->generation;
+	int ran = ((int (*)(Emulator*, int))block->native)(emu, native_budget(emu));
+	if (ran == 0) {
+		enter_block(cache, block); // too close to the next event, run it one instruction at a time
+		return false;
+	}
+	if (ran < block->num_ops && cache->generation == cache->entry_generation) {
+		// handed back partway: the interpreter finishes the block rather than looking up one starting here
+		enter_block(cache, block);
+		for (; cache->index < ran; ++cache->index) {
+			cache->next_pc += block->ops[cache->index].length;
+		}
+	}
+	return true;
+}
+
+#else
+
+bool jit_run(Emulator* emu) {
+	return false;
+}
+
+void destroy_jit(Jit* jit) {
+}
+
+#endif
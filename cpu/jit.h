@@ -0,0 +1,26 @@
+#pragma once
+#include "../global_definitions.h"
+
+// Optional x86-64 backend for DISPATCH_JIT, built only on Linux with ENABLE_JIT defined. Blocks from the
+// block cache that have been entered JIT_THRESHOLD times are translated into native code in an mmap'd
+// buffer; only the pages a block is written to are made writable, and only while it's compiled. If they
+// can't be made executable again the JIT is dropped and DISPATCH_BLOCK_CACHE takes over.
+// Register loads, ALU ops, INC/DEC and JR/JP are emitted inline, with the flags taken from the host's and
+// memory reached through the page tables; only reads and writes that miss them go through read8/write8.
+// Their cycles are handed to the components once, at the end of the block or before such an access, and a
+// block only runs natively if it ends before the next timer, PPU or APU event (native_budget). Everything
+// else calls its handler and is ticked on its own, as step() would.
+// A native block hands back after a branch, a halt, a finished frame or audio buffer, an I/O write, a ROM
+// bank switch or a write to cached RAM code.
+//
+// Without ENABLE_JIT, DISPATCH_JIT behaves like DISPATCH_BLOCK_CACHE.
+
+#if defined(ENABLE_JIT) && defined(__x86_64__) && defined(__linux__)
+#define JIT_AVAILABLE
+#endif
+
+#define JIT_THRESHOLD 8
+#define JIT_CODE_SIZE (1 << 20)
+
+bool jit_run(Emulator* emu);
+void destroy_jit(Jit* jit);
@@ -0,0 +1,41 @@
+#pragma once
+#include "../global_definitions.h"
+#include "block_cache.h"
+#include "cpu.h"
+#include "trace.h"
+
+// How code that runs instructions outside step() (JIT blocks, AOT modules through AotHost, fused handlers)
+// keeps the timer, PPU and APU in step with them. Internal to the core; frontends only see emulator.h.
+
+void tick_components(Emulator* emu, int t_cycles);
+bool native_tick(Emulator* emu, Cycles c, u16 next_pc);
+int native_budget(Emulator* emu);
+void native_ticks(Emulator* emu, const u8* cycles, int count);
+bool native_write(Emulator* emu, u16 address, u8 data);
+
+// For fused handlers, between the op that returned c and op: finishes and ticks the first, then moves the
+// cursor and PC on to op the way next_micro_op would. Returns false to end the group, leaving the rest to
+// later steps. c is then either untouched, for the caller to finish and tick as usual, or zero once it has
+// already been ticked and step() has to return before the next op.
+static inline bool continue_fusion(Emulator* emu, const MicroOp* op, Cycles* c) {
+	BlockCache* cache = emu->cpu.block_cache;
+	Cpu* cpu = &emu->cpu;
+	if (cache->current == NULL || cache->next_pc != cpu->registers.pc || cpu->should_update_IME
+		|| (cpu->IME && cpu->pending_interrupts) || emu->spin.enabled) {
+		return false;
+	}
+	tick_components(emu, finish_step(emu, *c).t_cycles);
+	if (emu->gpu.should_draw || emu->apu.buffer_full) {
+		*c = (Cycles) { 0, 0 };
+		return false;
+	}
+	if (++cache->index == cache->current->num_ops) {
+		cache->current = NULL;
+	}
+	else {
+		cache->next_pc += op->length;
+	}
+	trace_instruction(emu, op->opcode, op->operand);
+	skip_instruction(emu, op->length);
+	return true;
+}
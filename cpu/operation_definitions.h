@@ -108,10 +108,10 @@ typedef enum {
 } flag_action;
 
 typedef struct {
-	flag_action zero;
-	flag_action sub;
-	flag_action halfcarry;
-	flag_action carry;
+	u8 zero : 2; // flag_action
+	u8 sub : 2;
+	u8 halfcarry : 2;
+	u8 carry : 2;
 } instruction_flags;
 
 typedef struct {
@@ -125,16 +125,18 @@ typedef struct {
 } alu16_return;
 
 
+// Packed into 8 bytes so both tables fit in 4KB and get_operation copies a single word. The enums are
+// stored in the smallest field that holds all their values; dest also holds BIT's bit number and RST's
+// address, source SET and RES's bit number. Mnemonics live in the separate operation_mnemonics tables.
 typedef struct {
-	char* mnemonic;
-	instruction_type type;
-	address_mode dest_addr_mode;
-	address_mode source_addr_mode;
-	operand_type dest;
-	operand_type source;
-	condition condition;
-	secondary secondary;
-	u8 m_cycles;
+	u8 type; // instruction_type
+	u8 dest_addr_mode : 4; // address_mode
+	u8 source_addr_mode : 4;
+	u8 dest; // operand_type
+	u8 source : 5;
+	u8 condition : 3; // condition
+	u8 secondary : 3; // secondary
+	u8 m_cycles : 5;
 	u8 t_cycles;
 	instruction_flags flag_actions;
 	u8 opcode;
@@ -142,4 +144,6 @@ typedef struct {
 
 extern Operation operations[0x100];
 extern Operation cb_operations[0x100];
+extern const char* const operation_mnemonics[0x100];
+extern const char* const cb_operation_mnemonics[0x100];
 
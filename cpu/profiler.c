@@ -0,0 +1,56 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "profiler.h"
+#include "operations.h"
+
+void reset_opcode_profile(Cpu* cpu) {
+#ifdef ENABLE_OPCODE_PROFILE
+	memset(&cpu->profile, 0, sizeof(OpcodeProfile));
+#endif
+}
+
+#ifdef ENABLE_OPCODE_PROFILE
+static const OpcodeProfile* sort_profile; // for compare_entries, qsort has no context argument
+
+static unsigned long long entry_cycles(int entry) {
+	return entry < 0x100 ? sort_profile->t_cycles[entry] : sort_profile->cb_t_cycles[entry - 0x100];
+}
+
+static int compare_entries(const void* a, const void* b) {
+	unsigned long long x = entry_cycles(*(const int*)a);
+	unsigned long long y = entry_cycles(*(const int*)b);
+	return x < y ? 1 : x > y ? -1 : 0;
+}
+#endif
+
+// Every opcode and CB opcode that ran, most t-cycles first.
+void print_opcode_profile(Cpu* cpu) {
+#ifdef ENABLE_OPCODE_PROFILE
+	const OpcodeProfile* profile = &cpu->profile;
+	int entries[0x200];
+	int num_entries = 0;
+	unsigned long long total = 0;
+	for (int i = 0; i < 0x100; ++i) {
+		if (profile->count[i]) entries[num_entries++] = i;
+		if (profile->cb_count[i]) entries[num_entries++] = 0x100 + i;
+		total += profile->t_cycles[i] + profile->cb_t_cycles[i];
+	}
+	sort_profile = profile;
+	qsort(entries, num_entries, sizeof(int), compare_entries);
+
+	printf("OPCODE PROFILE:\n%12s %14s %7s  %s\n", "count", "t-cycles", "share", "opcode");
+	for (int i = 0; i < num_entries; ++i) {
+		int entry = entries[i];
+		bool cb = entry >= 0x100;
+		u8 opcode = entry & 0xFF;
+		const char* mnemonic = cb ? cb_operation_mnemonics[opcode] : operation_mnemonics[opcode];
+		unsigned long long count = cb ? profile->cb_count[opcode] : profile->count[opcode];
+		unsigned long long t_cycles = entry_cycles(entry);
+		printf("%12llu %14llu %6.2f%%  %s%02X %s\n", count, t_cycles, total ? 100.0 * t_cycles / total : 0.0,
+			cb ? "CB " : "", opcode, mnemonic ? mnemonic : "unimplemented");
+	}
+#else
+	printf("Opcode profile not available, build with ENABLE_OPCODE_PROFILE\n");
+#endif
+}
@@ -0,0 +1,24 @@
+#pragma once
+#include "../global_definitions.h"
+
+// Per-opcode execution counts and t-cycles, built with ENABLE_OPCODE_PROFILE. Every instruction the
+// interpreter runs is counted under its opcode, or its CB opcode for CB-prefixed ones, with the cycles it
+// took including taken branches but not interrupt dispatch. Native JIT and AOT blocks aren't counted, and
+// fusion is left off so each op is seen on its own. Without the define profile_op compiles to nothing.
+
+static inline void profile_op(Cpu* cpu, u8 opcode, u16 operand, Cycles c) {
+#ifdef ENABLE_OPCODE_PROFILE
+	int t_cycles = c.t_cycles + cpu->extra_cycles.t_cycles;
+	if (opcode == 0xCB) {
+		++cpu->profile.cb_count[(u8)operand];
+		cpu->profile.cb_t_cycles[(u8)operand] += t_cycles;
+	}
+	else {
+		++cpu->profile.count[opcode];
+		cpu->profile.t_cycles[opcode] += t_cycles;
+	}
+#endif
+}
+
+void reset_opcode_profile(Cpu* cpu);
+void print_opcode_profile(Cpu* cpu);
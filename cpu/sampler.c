@@ -0,0 +1,223 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sampler.h"
+#include "block_cache.h"
+
+#ifdef ENABLE_PC_SAMPLER
+static void reset_pc_sampler(Sampler* sampler, unsigned long long clock) {
+	sampler->next_sample = clock + sampler->interval;
+	sampler->total_samples = 0;
+	sampler->dropped_samples = 0;
+	sampler->depth = 0;
+	for (int i = 0; i < PC_TABLE_SIZE; ++i) {
+		sampler->pcs[i].key = NO_SAMPLE;
+	}
+	for (int i = 0; i < STACK_TABLE_SIZE; ++i) {
+		sampler->stacks[i].key = NO_SAMPLE;
+	}
+}
+
+static u32 sample_key(Emulator* emu, u16 pc) {
+	int region_end;
+	int bank = code_bank(emu, pc, &region_end);
+	return ((u32)(bank < 0 ? OTHER_BANK : bank) << 16) | pc;
+}
+
+static u32 hash_key(u32 key) {
+	key ^= key >> 16;
+	key *= 0x45D9F3B;
+	return key ^ (key >> 16);
+}
+
+static void count_pc(Sampler* sampler, u32 key, unsigned long long samples) {
+	for (u32 i = hash_key(key), probes = 0; probes < PC_TABLE_SIZE; ++i, ++probes) {
+		PcSample* entry = &sampler->pcs[i & (PC_TABLE_SIZE - 1)];
+		if (entry->key == NO_SAMPLE) {
+			entry->key = key;
+			entry->samples = 0;
+		}
+		if (entry->key == key) {
+			entry->samples += samples;
+			return;
+		}
+	}
+	sampler->dropped_samples += samples;
+}
+
+static void count_stack(Sampler* sampler, u32 key, unsigned long long samples) {
+	int depth = sampler->depth < SAMPLED_STACK_DEPTH ? sampler->depth : SAMPLED_STACK_DEPTH;
+	u32 frames[SAMPLED_STACK_DEPTH];
+	u32 hash = hash_key(key);
+	for (int i = 0; i < depth; ++i) {
+		frames[i] = sampler->stack[sampler->depth - 1 - i].entry;
+		hash = hash_key(hash ^ frames[i]);
+	}
+
+	for (u32 i = hash, probes = 0; probes < STACK_TABLE_SIZE; ++i, ++probes) {
+		StackSample* entry = &sampler->stacks[i & (STACK_TABLE_SIZE - 1)];
+		if (entry->key == NO_SAMPLE) {
+			entry->key = key;
+			entry->depth = depth;
+			memcpy(entry->frames, frames, depth * sizeof(u32));
+			entry->samples = 0;
+		}
+		if (entry->key == key && entry->depth == depth && !memcmp(entry->frames, frames, depth * sizeof(u32))) {
+			entry->samples += samples;
+			return;
+		}
+	}
+	sampler->dropped_samples += samples;
+}
+#endif
+
+// Starts sampling every interval t-cycles from now, clearing anything recorded so far; 0 stops and frees the
+// sampler. Returns -1 if it couldn't be allocated or the core was built without ENABLE_PC_SAMPLER.
+int set_pc_sampler(Emulator* emu, int interval) {
+#ifdef ENABLE_PC_SAMPLER
+	if (interval <= 0) {
+		destroy_pc_sampler(emu);
+		return 0;
+	}
+	if (emu->sampler == NULL) {
+		emu->sampler = (Sampler*)malloc(sizeof(Sampler));
+		if (emu->sampler == NULL) {
+			return -1;
+		}
+	}
+	emu->sampler->interval = interval;
+	reset_pc_sampler(emu->sampler, emu->clock);
+	return 0;
+#else
+	return interval > 0 ? -1 : 0;
+#endif
+}
+
+void destroy_pc_sampler(Emulator* emu) {
+#ifdef ENABLE_PC_SAMPLER
+	free(emu->sampler);
+	emu->sampler = NULL;
+#endif
+}
+
+// Counts every sample that fell due up to emu->clock against the current PC. A fast-forward or a long
+// instruction can cover several intervals at once, all of them spent at this PC.
+void take_samples(Emulator* emu) {
+#ifdef ENABLE_PC_SAMPLER
+	Sampler* sampler = emu->sampler;
+	unsigned long long samples = (emu->clock - sampler->next_sample) / sampler->interval + 1;
+	sampler->next_sample += samples * sampler->interval;
+	sampler->total_samples += samples;
+
+	u32 key = sample_key(emu, emu->cpu.registers.pc);
+	count_pc(sampler, key, samples);
+	count_stack(sampler, key, samples);
+#endif
+}
+
+// Frames at or below the new SP belong to calls that were never returned from (the routine popped its
+// return address or reset SP), so they're dropped before the new one goes on. A full stack loses its
+// outermost frame.
+void sampler_push(Emulator* emu) {
+#ifdef ENABLE_PC_SAMPLER
+	Sampler* sampler = emu->sampler;
+	u16 sp = emu->cpu.registers.sp;
+	while (sampler->depth > 0 && sampler->stack[sampler->depth - 1].sp <= sp) {
+		--sampler->depth;
+	}
+	if (sampler->depth == MAX_SHADOW_DEPTH) {
+		memmove(sampler->stack, sampler->stack + 1, (MAX_SHADOW_DEPTH - 1) * sizeof(ShadowFrame));
+		--sampler->depth;
+	}
+	sampler->stack[sampler->depth++] = (ShadowFrame) { sample_key(emu, emu->cpu.registers.pc), sp };
+#endif
+}
+
+// Pops every frame whose return address is now above SP, normally just the innermost one.
+void sampler_pop(Emulator* emu) {
+#ifdef ENABLE_PC_SAMPLER
+	Sampler* sampler = emu->sampler;
+	u16 sp = emu->cpu.registers.sp;
+	while (sampler->depth > 0 && sampler->stack[sampler->depth - 1].sp < sp) {
+		--sampler->depth;
+	}
+#endif
+}
+
+#ifdef ENABLE_PC_SAMPLER
+static int compare_pcs(const void* a, const void* b) {
+	unsigned long long x = (*(const PcSample* const*)a)->samples;
+	unsigned long long y = (*(const PcSample* const*)b)->samples;
+	return x < y ? 1 : x > y ? -1 : 0;
+}
+
+static int compare_stacks(const void* a, const void* b) {
+	unsigned long long x = (*(const StackSample* const*)a)->samples;
+	unsigned long long y = (*(const StackSample* const*)b)->samples;
+	return x < y ? 1 : x > y ? -1 : 0;
+}
+
+static void print_key(u32 key) {
+	u32 bank = key >> 16;
+	if (bank == BIOS_BANK) printf("BIOS:%04X", key & 0xFFFF);
+	else if (bank == RAM_BANK) printf(" RAM:%04X", key & 0xFFFF);
+	else if (bank == OTHER_BANK) printf("  --:%04X", key & 0xFFFF);
+	else printf("  %02X:%04X", bank, key & 0xFFFF);
+}
+#endif
+
+// The max_lines most sampled bank:PCs, then the max_lines most sampled call stacks, outermost routine first
+// and the sampled PC last.
+void print_pc_profile(Emulator* emu, int max_lines) {
+#ifdef ENABLE_PC_SAMPLER
+	Sampler* sampler = emu->sampler;
+	if (sampler == NULL) {
+		printf("PC sampler is off, start it with set_pc_sampler\n");
+		return;
+	}
+	unsigned long long total = sampler->total_samples;
+
+	const PcSample** pcs = (const PcSample**)malloc(PC_TABLE_SIZE * sizeof(PcSample*));
+	const StackSample** stacks = (const StackSample**)malloc(STACK_TABLE_SIZE * sizeof(StackSample*));
+	if (pcs == NULL || stacks == NULL) {
+		free(pcs);
+		free(stacks);
+		return;
+	}
+	int num_pcs = 0;
+	for (int i = 0; i < PC_TABLE_SIZE; ++i) {
+		if (sampler->pcs[i].key != NO_SAMPLE) pcs[num_pcs++] = &sampler->pcs[i];
+	}
+	int num_stacks = 0;
+	for (int i = 0; i < STACK_TABLE_SIZE; ++i) {
+		if (sampler->stacks[i].key != NO_SAMPLE) stacks[num_stacks++] = &sampler->stacks[i];
+	}
+	qsort(pcs, num_pcs, sizeof(PcSample*), compare_pcs);
+	qsort(stacks, num_stacks, sizeof(StackSample*), compare_stacks);
+
+	printf("PC PROFILE: %llu samples every %d t-cycles, %llu dropped\n", total, sampler->interval, sampler->dropped_samples);
+	printf("%12s %7s  %s\n", "samples", "share", "bank:pc");
+	for (int i = 0; i < num_pcs && i < max_lines; ++i) {
+		printf("%12llu %6.2f%%  ", pcs[i]->samples, total ? 100.0 * pcs[i]->samples / total : 0.0);
+		print_key(pcs[i]->key);
+		printf("\n");
+	}
+
+	printf("CALL STACKS:\n%12s %7s  %s\n", "samples", "share", "routines > bank:pc");
+	for (int i = 0; i < num_stacks && i < max_lines; ++i) {
+		const StackSample* stack = stacks[i];
+		printf("%12llu %6.2f%%  ", stack->samples, total ? 100.0 * stack->samples / total : 0.0);
+		for (int frame = stack->depth - 1; frame >= 0; --frame) {
+			print_key(stack->frames[frame]);
+			printf(" >");
+		}
+		print_key(stack->key);
+		printf("\n");
+	}
+
+	free(pcs);
+	free(stacks);
+#else
+	printf("PC profile not available, build with ENABLE_PC_SAMPLER\n");
+#endif
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include "../global_definitions.h"
+
+// Sampling PC profiler, built with ENABLE_PC_SAMPLER and switched on with set_pc_sampler. Every interval
+// emulated t-cycles it records the PC of the next instruction, keyed by the bank it's fetched from (the
+// mapped ROM bank from cartridge.rom_bank, BIOS or RAM, see code_bank) so banked routines at the same
+// address stay apart. Skipped HALT and spin-loop time is sampled too, at the PC it's spent at.
+//
+// A shadow call stack follows CALL, RST and interrupt entry (run_interrupt) and RET/RETI. Frames are
+// matched on SP, so code that drops return addresses or resets SP just leaves frames to be discarded at the
+// next call or return further up. Each sample also counts against the innermost SAMPLED_STACK_DEPTH
+// routine entries, for the call-stack profile. print_pc_profile reports both.
+
+#define MAX_SHADOW_DEPTH 64
+#define SAMPLED_STACK_DEPTH 8
+#define PC_TABLE_SIZE 0x10000 // must be a power of two
+#define STACK_TABLE_SIZE 0x4000 // must be a power of two
+
+// Sample keys are (bank << 16) | pc, bank as in code_bank, with one more for code anywhere else.
+#define NO_SAMPLE 0xFFFFFFFF
+#define OTHER_BANK 0x1FF
+
+typedef struct {
+	u32 key;
+	unsigned long long samples;
+} PcSample;
+
+typedef struct {
+	u32 key; // where the sample was taken
+	u8 depth;
+	u32 frames[SAMPLED_STACK_DEPTH]; // routine entries, innermost first
+	unsigned long long samples;
+} StackSample;
+
+typedef struct {
+	u32 entry; // sample key of the routine called
+	u16 sp; // SP once the return address was pushed
+} ShadowFrame;
+
+struct _sampler {
+	int interval;
+	unsigned long long next_sample; // emu->clock to take the next sample at
+	unsigned long long total_samples;
+	unsigned long long dropped_samples; // table full
+
+	ShadowFrame stack[MAX_SHADOW_DEPTH];
+	int depth;
+
+	PcSample pcs[PC_TABLE_SIZE];
+	StackSample stacks[STACK_TABLE_SIZE];
+};
+
+int set_pc_sampler(Emulator* emu, int interval);
+void destroy_pc_sampler(Emulator* emu);
+void print_pc_profile(Emulator* emu, int max_lines);
+void take_samples(Emulator* emu);
+void sampler_push(Emulator* emu);
+void sampler_pop(Emulator* emu);
+
+// Hooks, nothing at all without the define and a pointer test while the sampler is off.
+
+static inline void sample_pc(Emulator* emu) {
+#ifdef ENABLE_PC_SAMPLER
+	if (emu->sampler != NULL && emu->clock >= emu->sampler->next_sample) {
+		take_samples(emu);
+	}
+#endif
+}
+
+// After a call, RST or interrupt entry has pushed its return address and jumped.
+static inline void sampler_call(Emulator* emu) {
+#ifdef ENABLE_PC_SAMPLER
+	if (emu->sampler != NULL) {
+		sampler_push(emu);
+	}
+#endif
+}
+
+// After a taken RET or RETI.
+static inline void sampler_return(Emulator* emu) {
+#ifdef ENABLE_PC_SAMPLER
+	if (emu->sampler != NULL) {
+		sampler_pop(emu);
+	}
+#endif
+}
@@ -0,0 +1,204 @@
+#include <string.h>
+#include "spin_loop.h"
+#include "cpu.h"
+#include "handlers.h"
+#include "operations.h"
+#include "../timer/timer.h"
+#include "../gpu/gpu.h"
+
+#define MAX_SPIN_LOOP_OPS 16
+#define NOT_REGISTER_ONLY 0xFFFFFFFFu // no register mask, see written_registers
+
+typedef struct {
+	const Operation* op;
+	u16 operand;
+} LoopOp;
+
+static u32 register_bits(operand_type type) {
+	switch (type) {
+	case BC: return (1 << B) | (1 << C);
+	case DE: return (1 << D) | (1 << E);
+	case HL: return (1 << H) | (1 << L);
+	case A:
+	case B:
+	case C:
+	case D:
+	case E:
+	case H:
+	case L:
+		return 1 << type;
+	default:
+		return 0;
+	}
+}
+
+static u16 register_pair(Emulator* emu, operand_type type) {
+	switch (type) {
+	case BC: return emu->cpu.registers.bc;
+	case DE: return emu->cpu.registers.de;
+	default: return emu->cpu.registers.hl;
+	}
+}
+
+// Counts on its own or is driven by the APU, so can change between events.
+static bool stable_address(u16 address) {
+	return address != DIV && address != TIMA && !(address >= NR10 && address <= 0xFF3F);
+}
+
+static bool stable_source(Emulator* emu, const Operation* op, u16 operand, u32 written) {
+	switch (op->source_addr_mode) {
+	case ADDR_MODE_NONE:
+	case REGISTER:
+	case MEM_READ:
+		return true;
+	case ADDRESS_R16:
+		return !(written & register_bits(op->source)) && stable_address(register_pair(emu, op->source));
+	case ADDRESS_R8_OFFSET:
+		return !(written & register_bits(C)) && stable_address(0xFF00 + emu->cpu.registers.c);
+	case MEM_READ_ADDR:
+		return stable_address(operand);
+	case MEM_READ_ADDR_OFFSET:
+		return stable_address(0xFF00 + (u8)operand);
+	default:
+		return false;
+	}
+}
+
+// Registers an op writes, or NOT_REGISTER_ONLY if it does anything but read registers and memory, write
+// registers and branch.
+static u32 written_registers(const Operation* op) {
+	switch (op->type) {
+	case NOP:
+	case SCF:
+	case CCF:
+	case BIT:
+		return 0;
+	case JP:
+		return (op->source_addr_mode == MEM_READ || op->source_addr_mode == MEM_READ16) ? 0 : NOT_REGISTER_ONLY;
+	case LD:
+		return op->secondary == SECONDARY_NONE && op->dest_addr_mode == REGISTER ? register_bits(op->dest)
+			: NOT_REGISTER_ONLY;
+	case ADD:
+	case ADC:
+	case SUB:
+	case SBC:
+	case CP:
+	case AND:
+	case OR:
+	case XOR:
+	case INC:
+	case DEC:
+	case CPL:
+	case RL:
+	case RR:
+	case RLC:
+	case RRC:
+	case SLA:
+	case SRA:
+	case SRL:
+	case SWAP:
+	case RES:
+	case SET_OP:
+		return op->dest_addr_mode == REGISTER ? register_bits(op->dest) : NOT_REGISTER_ONLY;
+	default:
+		return NOT_REGISTER_ONLY;
+	}
+}
+
+bool is_spin_loop(Emulator* emu, u16 head, u16 tail) {
+	LoopOp ops[MAX_SPIN_LOOP_OPS];
+	int num_ops = 0;
+	u32 written = 0;
+
+	// tail is where the step that jumped back started: the jump itself, or a fused group ending in it
+	u16 address = head;
+	bool reached_tail = false;
+	for (;;) {
+		if (num_ops == MAX_SPIN_LOOP_OPS || address - head > MAX_SPIN_LOOP_BYTES) {
+			return false;
+		}
+		u8 opcode = read8(emu, address);
+		u8 length = instruction_lengths[opcode];
+		const Operation* op = &operations[opcode];
+		u16 operand = read_operand(emu, address, length);
+		if (op->type == CB) {
+			op = &cb_operations[(u8)operand];
+		}
+
+		u32 registers = written_registers(op);
+		if (registers == NOT_REGISTER_ONLY) {
+			return false;
+		}
+		written |= registers;
+		ops[num_ops++] = (LoopOp) { op, operand };
+
+		reached_tail |= address == tail;
+		if (address >= tail && op->type == JP) {
+			break;
+		}
+		address += length;
+	}
+	if (!reached_tail) {
+		return false;
+	}
+
+	// Reads through a register pair are only known to hit the same address each time round if nothing in
+	// the loop writes the pair.
+	for (int i = 0; i < num_ops; ++i) {
+		if (!stable_source(emu, ops[i].op, ops[i].operand, written)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// Called after every instruction while the switch is on, with the PC it started at. Returns the cycles the
+// last iteration took once a spin loop has come back to its head twice in the same state, 0 otherwise. The
+// cycles of each instruction in that iteration are left in iteration_cycles.
+int spin_loop_step(Emulator* emu, u16 pc, int t_cycles) {
+	SpinLoop* spin = &emu->spin;
+	u16 next_pc = emu->cpu.registers.pc;
+	if (spin->num_steps < MAX_SPIN_LOOP_STEPS) {
+		spin->step_cycles[spin->num_steps++] = t_cycles;
+	}
+	else {
+		spin->num_steps = MAX_SPIN_LOOP_STEPS + 1;
+	}
+
+	if (next_pc < pc && pc - next_pc <= MAX_SPIN_LOOP_BYTES) {
+		int iteration = 0;
+		sync_flags(&emu->cpu);
+		if (next_pc != spin->head || pc != spin->tail) {
+			spin->head = next_pc;
+			spin->tail = pc;
+			spin->is_spin_loop = is_spin_loop(emu, next_pc, pc);
+		}
+		else if (spin->is_spin_loop && spin->num_steps <= MAX_SPIN_LOOP_STEPS && memcmp(&spin->registers, &emu->cpu.registers, sizeof(Registers)) == 0) {
+			int cycles = 0;
+			for (int i = 0; i < spin->num_steps; ++i) {
+				cycles += spin->step_cycles[i];
+			}
+			if (cycles < spin->quiet_cycles) {
+				spin->iteration_steps = spin->num_steps;
+				for (int i = 0; i < spin->num_steps; ++i) {
+					spin->iteration_cycles[i] = spin->step_cycles[i];
+				}
+				iteration = cycles;
+			}
+		}
+		spin->registers = emu->cpu.registers;
+		spin->num_steps = 0;
+		// an event during the next iteration can change what it reads after the read, leaving the registers
+		// the same but the one after that different
+		int timer_cycles = timer_next_event(emu);
+		int gpu_cycles = gpu_next_event(emu);
+		spin->quiet_cycles = timer_cycles < gpu_cycles ? timer_cycles : gpu_cycles;
+		return iteration;
+	}
+
+	if (next_pc < spin->head || next_pc > spin->tail) { // left the loop, or took an interrupt
+		spin->head = spin->tail = 0;
+		spin->is_spin_loop = false;
+	}
+	return 0;
+}
@@ -0,0 +1,13 @@
+#pragma once
+#include "../global_definitions.h"
+
+// Polling-loop detection for set_spin_loop_skip. A loop is a short backward jump whose body only moves data
+// into registers, does 8-bit arithmetic on them and branches: no writes, no stack, no IME changes, and only
+// memory that can't change between timer and PPU events (so not DIV, TIMA or the sound registers). Once
+// such a loop comes back to its head twice with identical registers it's stuck until something it reads
+// changes, and step() can skip whole iterations up to the next event.
+
+#define MAX_SPIN_LOOP_BYTES 32
+
+bool is_spin_loop(Emulator* emu, u16 head, u16 tail);
+int spin_loop_step(Emulator* emu, u16 pc, int t_cycles);
@@ -0,0 +1,25 @@
+#pragma once
+#include "../global_definitions.h"
+
+// M-cycle timing, built with ENABLE_MCYCLE_TIMING and chosen per instance with TIMING_MCYCLE. Instructions
+// run through the threaded handlers (cpu_step_timed) whatever the dispatch mode, and every read8 or write8
+// they make first runs the timer, PPU and APU up to the start of the M-cycle the access falls in. The rest
+// of the instruction's cycles are run before the interrupt check, so an interrupt raised partway through is
+// taken at the end of that instruction rather than the next.
+//
+// An access's M-cycle comes from its order: the opcode and immediate bytes are fetched first, then each
+// access takes one M-cycle, after the internal cycle that PUSH, CALL, RST and conditional RET spend before
+// touching the stack (access_delay). Interrupt dispatch pushes PC in its third and fourth M-cycles.
+// Spin-loop skipping is off for these instances.
+
+void tick_until(Emulator* emu, int t_cycles);
+
+static inline void timed_access(Emulator* emu) {
+#ifdef ENABLE_MCYCLE_TIMING
+	if (emu->timing.in_instruction) {
+		int due = emu->timing.next_access;
+		emu->timing.next_access += 4;
+		tick_until(emu, due);
+	}
+#endif
+}
@@ -0,0 +1,95 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "trace.h"
+#include "handlers.h"
+
+// Starts a trace keeping the last records records (rounded up to a power of two), dropping any earlier one.
+// Returns -1 if the buffer couldn't be allocated or the core was built without ENABLE_TRACE.
+int start_trace(Emulator* emu, int records) {
+	stop_trace(emu);
+#ifdef ENABLE_TRACE
+	u32 size = 1;
+	while (size < (u32)records && size < 0x80000000) {
+		size <<= 1;
+	}
+	Trace* trace = (Trace*)malloc(sizeof(Trace));
+	if (trace == NULL) {
+		return -1;
+	}
+	trace->records = (TraceRecord*)malloc(size * sizeof(TraceRecord));
+	if (trace->records == NULL) {
+		free(trace);
+		return -1;
+	}
+	trace->mask = size - 1;
+	trace->position = 0;
+	trace->pc = emu->cpu.registers.pc;
+	emu->trace = trace;
+	return 0;
+#else
+	return -1;
+#endif
+}
+
+void stop_trace(Emulator* emu) {
+	if (emu->trace != NULL) {
+		free(emu->trace->records);
+		free(emu->trace);
+		emu->trace = NULL;
+	}
+}
+
+void record_decoded(Emulator* emu) {
+	u16 pc = emu->cpu.registers.pc;
+	u8 opcode = fetch8(emu, pc);
+	trace_instruction(emu, opcode, read_operand(emu, pc, instruction_lengths[opcode]));
+}
+
+// Copies up to the last count records into out, oldest first, and returns how many there were.
+int read_trace(Emulator* emu, TraceRecord* out, int count) {
+	Trace* trace = emu->trace;
+	if (trace == NULL || count <= 0) {
+		return 0;
+	}
+	unsigned long long available = trace->position < (unsigned long long)trace->mask + 1 ? trace->position : (unsigned long long)trace->mask + 1;
+	if ((unsigned long long)count > available) {
+		count = (int)available;
+	}
+	for (int i = 0; i < count; ++i) {
+		out[i] = trace->records[(trace->position - count + i) & trace->mask];
+	}
+	return count;
+}
+
+// Writes the last count records to path for tools/trace_decode.c. Returns the number written, or -1 if the
+// file couldn't be written.
+int dump_trace(Emulator* emu, const char* path, int count) {
+	if (emu->trace == NULL || count <= 0) {
+		count = 0;
+	}
+	else if ((u32)count > emu->trace->mask + 1) {
+		count = emu->trace->mask + 1;
+	}
+	TraceRecord* records = (TraceRecord*)malloc((count ? count : 1) * sizeof(TraceRecord));
+	if (records == NULL) {
+		return -1;
+	}
+	count = read_trace(emu, records, count);
+
+	FILE* file = fopen(path, "wb");
+	if (file == NULL) {
+		free(records);
+		return -1;
+	}
+	TraceHeader header;
+	memcpy(header.magic, TRACE_MAGIC, 4);
+	header.version = TRACE_VERSION;
+	header.record_size = sizeof(TraceRecord);
+	header.count = count;
+	bool ok = fwrite(&header, sizeof(header), 1, file) == 1
+		&& fwrite(records, sizeof(TraceRecord), count, file) == (size_t)count;
+	ok = fclose(file) == 0 && ok;
+	free(records);
+	return ok ? count : -1;
+}
@@ -0,0 +1,123 @@
+#pragma once
+#include "../global_definitions.h"
+#include "cpu.h"
+
+// Binary execution trace, built with ENABLE_TRACE (see build_config.h) and switched on at runtime with
+// start_trace. Each instruction, interrupt entry and
+// memory write goes into a preallocated ring of fixed-size records, overwriting the oldest, so it can be
+// left on and the last stretch before a divergence dumped afterwards with dump_trace. The hooks cost one
+// pointer test while it's off.
+//
+// Instructions are recorded wherever the interpreter starts one (switch, threaded, block cache and each op
+// of a fused group). JIT and AOT native blocks don't run while tracing, their code goes through the block
+// cache instead. With ENABLE_LAZY_FLAGS a pending flag result is resolved before the registers are
+// copied, so F is always the real one.
+//
+// tools/trace_decode.c prints a dumped trace.
+
+#define TRACE_MAGIC "YBTR"
+#define TRACE_VERSION 1
+
+typedef enum {
+	TRACE_INSTRUCTION, // value is the opcode, operand its immediate or CB opcode, registers from before it
+	TRACE_INTERRUPT, // operand is the vector, registers.pc where it returns to
+	TRACE_WRITE // value was written to operand, registers.pc is the last instruction (the PPU writes IF too)
+} TraceKind;
+
+typedef struct {
+	unsigned long long clock; // emu->clock at the time
+	Registers registers; // only pc for writes
+	u8 kind; // TraceKind
+	u8 value;
+	u16 operand;
+} TraceRecord;
+
+// Header of a dump_trace file, followed by count records, oldest first, all in host byte order.
+typedef struct {
+	char magic[4];
+	u32 version;
+	u32 record_size;
+	u32 count;
+} TraceHeader;
+
+struct _trace {
+	TraceRecord* records;
+	u32 mask; // number of records - 1, a power of two
+	unsigned long long position; // records written since start_trace
+	u16 pc; // of the last instruction, for its writes
+};
+
+int start_trace(Emulator* emu, int records);
+void stop_trace(Emulator* emu);
+int read_trace(Emulator* emu, TraceRecord* out, int count);
+int dump_trace(Emulator* emu, const char* path, int count);
+void record_decoded(Emulator* emu);
+
+// Whether a trace is running; always false without ENABLE_TRACE.
+static inline bool tracing(Emulator* emu) {
+#ifdef ENABLE_TRACE
+	return emu->trace != NULL;
+#else
+	return false;
+#endif
+}
+
+static inline TraceRecord* next_trace_record(Trace* trace) {
+	return &trace->records[trace->position++ & trace->mask];
+}
+
+// Before the instruction at PC runs.
+static inline void trace_instruction(Emulator* emu, u8 opcode, u16 operand) {
+#ifdef ENABLE_TRACE
+	Trace* trace = emu->trace;
+	if (trace != NULL) {
+		sync_flags(&emu->cpu);
+		TraceRecord* record = next_trace_record(trace);
+		record->clock = emu->clock;
+		record->registers = emu->cpu.registers;
+		record->kind = TRACE_INSTRUCTION;
+		record->value = opcode;
+		record->operand = operand;
+		trace->pc = emu->cpu.registers.pc;
+	}
+#endif
+}
+
+// Same, for callers that haven't decoded the instruction themselves.
+static inline void trace_at_pc(Emulator* emu) {
+#ifdef ENABLE_TRACE
+	if (emu->trace != NULL) {
+		record_decoded(emu);
+	}
+#endif
+}
+
+// Before an interrupt's return address is pushed.
+static inline void trace_interrupt(Emulator* emu, u16 vector) {
+#ifdef ENABLE_TRACE
+	Trace* trace = emu->trace;
+	if (trace != NULL) {
+		sync_flags(&emu->cpu);
+		TraceRecord* record = next_trace_record(trace);
+		record->clock = emu->clock;
+		record->registers = emu->cpu.registers;
+		record->kind = TRACE_INTERRUPT;
+		record->value = 0;
+		record->operand = vector;
+	}
+#endif
+}
+
+static inline void trace_write(Emulator* emu, u16 address, u8 data) {
+#ifdef ENABLE_TRACE
+	Trace* trace = emu->trace;
+	if (trace != NULL) {
+		TraceRecord* record = next_trace_record(trace);
+		record->clock = emu->clock;
+		record->registers.pc = trace->pc;
+		record->kind = TRACE_WRITE;
+		record->value = data;
+		record->operand = address;
+	}
+#endif
+}
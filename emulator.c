@@ -1,3 +1,4 @@
+#include <limits.h>
 #include "emulator.h"
 #include "global_definitions.h"
 #include "./timer/timer.h"
@@ -6,9 +7,30 @@
 #include "./cpu/operations.h"
 #include "./gpu/gpu.h"
 #include "./apu/apu.h"
+#include "./cpu/jit.h"
+#include "./cpu/aot.h"
+#include "./cpu/block_cache.h"
+#include "./cpu/native.h"
+#include "./cpu/spin_loop.h"
+#include "./cpu/sampler.h"
+#include "./cpu/trace.h"
+#include "./cpu/timing.h"
+
+#define FRAME_CYCLES 70224
+#define SKIP_LIMIT FRAME_CYCLES // for when the LCD, timer and APU are all off
 
 
 int init_emulator(Emulator* emu, int sample_rate, int buffer_size) {
+	return init_emulator_timed(emu, sample_rate, buffer_size, DEFAULT_TIMING);
+}
+
+// init_emulator with a choice of timing. TIMING_MCYCLE fails with -1 in builds without ENABLE_MCYCLE_TIMING.
+int init_emulator_timed(Emulator* emu, int sample_rate, int buffer_size, TimingMode timing) {
+#ifndef ENABLE_MCYCLE_TIMING
+	if (timing == TIMING_MCYCLE) {
+		return -1;
+	}
+#endif
 	init_cpu(&emu->cpu);
 	init_mmu(&emu->mmu);
 	init_gpu(&emu->gpu);
@@ -16,21 +38,251 @@ int init_emulator(Emulator* emu, int sample_rate, int buffer_size) {
 	init_apu(&emu->apu, sample_rate, buffer_size);
 	memset(&emu->controller, 0, sizeof(Controller));
 
+	memset(&emu->spin, 0, sizeof(SpinLoop));
+	memset(&emu->timing, 0, sizeof(CycleTiming));
+	emu->timing.mode = timing;
+	emu->trace = NULL;
+#ifdef ENABLE_PC_SAMPLER
+	emu->sampler = NULL;
+#endif
+
 	emu->should_run = false;
 	emu->clock = 0;
+	update_joypad(emu);
 
 	return 0;
 }
 
 void update_emu_controller(Emulator* emu, Controller controller) {
 	emu->controller = controller;
+	update_joypad(emu);
 }
 
-int step(Emulator* emu) {
-	Operation to_exec = get_operation(emu);
+void set_dispatch_mode(Emulator* emu, DispatchMode mode) {
+	sync_flags(&emu->cpu); // the reference switch, JIT and AOT paths read registers.f directly
+	emu->cpu.dispatch_mode = mode;
+}
+
+static void forget_spin_loop(SpinLoop* spin) {
+	spin->head = spin->tail = 0;
+	spin->is_spin_loop = false;
+	spin->num_steps = 0;
+}
+
+// Fast-forwards polling loops (see cpu/spin_loop.h); spin.skipped_cycles counts the time skipped. Only
+// instructions run through step() one at a time are watched, not native JIT or AOT blocks.
+void set_spin_loop_skip(Emulator* emu, bool enabled) {
+	emu->spin.enabled = enabled;
+	forget_spin_loop(&emu->spin);
+}
+
+void tick_components(Emulator* emu, int t_cycles) {
+	timer_step(emu, t_cycles);
+	gpu_step(emu, t_cycles);
+	apu_step(&emu->apu, t_cycles);
+	emu->clock += t_cycles;
+	sample_pc(emu);
+}
+
+// Runs the components up to t_cycles into the current instruction, for TIMING_MCYCLE.
+void tick_until(Emulator* emu, int t_cycles) {
+	CycleTiming* timing = &emu->timing;
+	if (t_cycles > timing->ticked) {
+		// a frame or sample buffer finished earlier in the instruction has to last until step() returns
+		bool should_draw = timing->ticked > 0 && emu->gpu.should_draw;
+		bool buffer_full = timing->ticked > 0 && emu->apu.buffer_full;
+		timing->in_instruction = false; // the PPU reads VRAM and writes IF through read8 and write8
+		tick_components(emu, t_cycles - timing->ticked);
+		emu->gpu.should_draw |= should_draw;
+		emu->apu.buffer_full |= buffer_full;
+		timing->ticked = t_cycles;
+		timing->in_instruction = true;
+	}
+}
+
+// Cycles until the next 4-cycle tick on which a component does more than count: the timer overflows, the PPU
+// changes mode or raises a delayed STAT interrupt, or the APU fills its sample buffer.
+static int next_event(Emulator* emu, int limit) {
+	int cycles = limit;
+	int timer_cycles = timer_next_event(emu);
+	int gpu_cycles = gpu_next_event(emu);
+	int apu_cycles = apu_next_event(&emu->apu);
+	if (timer_cycles < cycles) cycles = timer_cycles;
+	if (gpu_cycles < cycles) cycles = gpu_cycles;
+	if (apu_cycles < cycles) cycles = apu_cycles;
+	return cycles;
+}
+
+// T-cycles a native block can take with the components ticked only now and then (native_ticks) rather than
+// after every instruction: anything shorter than this ends before the next event, with nothing for
+// finish_step to do in between. 0 while an interrupt or an EI/DI is due.
+int native_budget(Emulator* emu) {
+	if (emu->cpu.should_update_IME || (emu->cpu.IME && emu->cpu.pending_interrupts)) {
+		return 0;
+	}
+	return next_event(emu, INT_MAX);
+}
+
+// Ticks the components through count instructions of a native block, cycles[i] t-cycles each, within the
+// native_budget the block was entered with. The PPU takes them all at once; the timer (while it counts TIMA)
+// and the APU see instruction-sized steps differently and get them one at a time.
+void native_ticks(Emulator* emu, const u8* cycles, int count) {
+	if (count <= 0) {
+		return;
+	}
+	bool timer_on = emu->mmu.memory[TAC] & (1 << 2);
+	bool apu_on = emu->apu.nr52 & 0b10000000;
+	int t_cycles = 0;
+	for (int i = 0; i < count; ++i) {
+		if (timer_on) {
+			timer_step(emu, cycles[i]);
+		}
+		if (apu_on) {
+			apu_step(&emu->apu, cycles[i]);
+		}
+		t_cycles += cycles[i];
+	}
+	if (!timer_on) {
+		timer_skip(emu, t_cycles);
+	}
+	gpu_skip(emu, t_cycles);
+	emu->clock += t_cycles;
+	sample_pc(emu);
+}
+
+// write8 for a native block, with the components already ticked up to the instruction. Returns true when the
+// block has to hand back after it: the write went to an I/O register, which can raise an interrupt or move
+// the next event, or it switched a ROM bank or hit cached code.
+bool native_write(Emulator* emu, u16 address, u8 data) {
+	write8(emu, address, data);
+	BlockCache* cache = emu->cpu.block_cache;
+	return (address >= 0xFF00 && address < 0xFF80) || address == IE || cache->generation != cache->entry_generation;
+}
+
+// The rest of step() for one instruction of a native (JIT or AOT) block, with PC already past it.
+// Returns true when the block has to hand control back.
+bool native_tick(Emulator* emu, Cycles c, u16 next_pc) {
+	c = finish_step(emu, c);
+	tick_components(emu, c.t_cycles);
+
+	return emu->cpu.halted
+		|| emu->cpu.registers.pc != next_pc
+		|| emu->cpu.block_cache->generation != emu->cpu.block_cache->entry_generation
+		|| emu->gpu.should_draw
+		|| emu->apu.buffer_full;
+}
+
+static bool can_skip(Emulator* emu) {
+	return !emu->gpu.should_draw && !emu->apu.buffer_full && interrupts_idle(emu);
+}
+
+// Moves a halted CPU straight up to the tick the next event falls on, instead of one step() per 4 cycles.
+// The timer and PPU advance in one call each; the APU has no bulk form, so while it's on it's still ticked
+// every 4 cycles. Skips no more than limit cycles.
+static void fast_forward_halt(Emulator* emu, int limit) {
+	if (!can_skip(emu)) {
+		return;
+	}
+	int cycles = (next_event(emu, limit + 1) - 1) / 4 * 4; // stop short of the tick the event falls on
+	if (cycles <= 0) {
+		return;
+	}
+	if (emu->apu.nr52 & 0b10000000) {
+		for (int i = 0; i < cycles; i += 4) {
+			apu_step(&emu->apu, 4);
+		}
+	}
+	timer_skip(emu, cycles);
+	gpu_skip(emu, cycles);
+	emu->clock += cycles;
+	sample_pc(emu);
+}
+
+// Whether the APU could fill its buffer during the next t_cycles, however they're split up.
+static bool apu_may_fill(Apu* apu, int t_cycles) {
+	if (!(apu->nr52 & 0b10000000)) {
+		return false;
+	}
+	long long samples = ((long long)apu->sample_counter + (long long)apu->sample_rate * t_cycles) / (1048576 * 4);
+	return apu->buffer_position + samples >= apu->buffer_size;
+}
+
+// Skips whole iterations of a spin loop up to the next timer or PPU event. Nothing the loop reads can change
+// before then, so each would run exactly like the last one. The timer and APU see coarser steps than 4
+// cycles differently (an instruction can step over a TIMA edge), so they're replayed with the iteration's
+// instruction cycles; the PPU only counts until its next event and takes the whole span at once.
+static void fast_forward_spin(Emulator* emu, u16 pc, int t_cycles, int limit) {
+	int iteration = spin_loop_step(emu, pc, t_cycles);
+	if (iteration <= 0 || !can_skip(emu)) {
+		return;
+	}
+	SpinLoop* spin = &emu->spin;
+	int horizon = limit + 1;
+	int timer_cycles = timer_next_event(emu);
+	int gpu_cycles = gpu_next_event(emu);
+	if (timer_cycles < horizon) horizon = timer_cycles;
+	if (gpu_cycles < horizon) horizon = gpu_cycles;
+
+	bool timer_on = emu->mmu.memory[TAC] & (1 << 2);
+	int cycles = 0;
+	while (cycles + iteration < horizon && !apu_may_fill(&emu->apu, iteration)) {
+		for (int i = 0; i < spin->iteration_steps; ++i) {
+			if (timer_on) {
+				timer_step(emu, spin->iteration_cycles[i]);
+			}
+			apu_step(&emu->apu, spin->iteration_cycles[i]);
+		}
+		cycles += iteration;
+	}
+	if (cycles == 0) {
+		return;
+	}
+	if (!timer_on) {
+		timer_skip(emu, cycles);
+	}
+	gpu_skip(emu, cycles);
+	spin->quiet_cycles -= cycles;
+	emu->clock += cycles;
+	spin->skipped_cycles += cycles;
+	sample_pc(emu);
+}
+
+// One instruction plus whatever fast-forward follows it, skipping no more than limit cycles.
+static inline int run_step(Emulator* emu, int limit) {
 	Cycles c;
+	u16 pc = emu->cpu.registers.pc;
 	if (!emu->cpu.halted) {
-		c = cpu_step(emu, to_exec);
+#ifdef ENABLE_MCYCLE_TIMING
+		if (emu->timing.mode == TIMING_MCYCLE) {
+			c = cpu_step_timed(emu); // ticks as it goes
+		}
+		else
+#endif
+		switch (emu->cpu.dispatch_mode) {
+		case DISPATCH_SWITCH:
+			c = cpu_step(emu, get_operation(emu));
+			break;
+		case DISPATCH_THREADED:
+			c = cpu_step_threaded(emu);
+			break;
+		case DISPATCH_JIT:
+			if (jit_run(emu)) { // ran native code, components already ticked
+				forget_spin_loop(&emu->spin); // a loop run partly natively can't be measured
+				return 0;
+			}
+			c = cpu_step_cached(emu);
+			break;
+		case DISPATCH_AOT:
+			if (aot_run(emu)) {
+				forget_spin_loop(&emu->spin);
+				return 0;
+			}
+			c = cpu_step_cached(emu);
+			break;
+		default:
+			c = cpu_step_cached(emu);
+			break;
+		}
 	}
 	else {
 		c = run_halted(emu);
@@ -39,25 +291,71 @@ int step(Emulator* emu) {
 		return -1;
 	}
 
-	timer_step(emu, c.t_cycles);
-	gpu_step(emu, c.t_cycles);
-	apu_step(&emu->apu, c.t_cycles);
+	if (c.t_cycles) { // 0 after a fused group or a timed instruction, which have ticked everything already
+		tick_components(emu, c.t_cycles);
+	}
+	if (emu->cpu.halted) {
+		fast_forward_halt(emu, limit);
+	}
+	else if (emu->spin.enabled && emu->timing.mode == TIMING_INSTRUCTION) {
+		fast_forward_spin(emu, pc, c.t_cycles, limit);
+	}
 
 	return 0;
 }
 
+int step(Emulator* emu) {
+	return run_step(emu, SKIP_LIMIT);
+}
+
+// Runs for at least t_cycles, stopping early after the instruction that finishes a frame or fills the sample
+// buffer. Returns the RunStatus bits saying why it stopped. Runs past the budget by at most the last
+// instruction (or fused group or native block); fast-forwards are cut short at it. should_draw and
+// buffer_full only last until the next instruction, so the frontend should take the frame or samples before
+// calling again.
+int run_cycles(Emulator* emu, int t_cycles) {
+	unsigned long long end = emu->clock + (t_cycles > 0 ? t_cycles : 0);
+	while (emu->clock < end) {
+		unsigned long long left = end - emu->clock;
+		if (run_step(emu, left < SKIP_LIMIT ? (int)left : SKIP_LIMIT) < 0) {
+			return RUN_ERROR;
+		}
+		if (emu->gpu.should_draw || emu->apu.buffer_full) {
+			return (emu->gpu.should_draw ? RUN_FRAME : 0)
+				| (emu->apu.buffer_full ? RUN_AUDIO : 0)
+				| (emu->clock >= end ? RUN_BUDGET : 0);
+		}
+	}
+	return RUN_BUDGET;
+}
+
+// Runs until the next frame is ready, or for a frame's worth of cycles with the LCD off. Stops early on a
+// full sample buffer like run_cycles, in which case RUN_FRAME isn't set and the frame is still to come.
+int run_frame(Emulator* emu) {
+	return run_cycles(emu, FRAME_CYCLES);
+}
+
 
 void destroy_emulator(Emulator* emu) {
+	destroy_cpu(&emu->cpu);
 	destroy_mmu(&emu->mmu);
 	destroy_gpu(&emu->gpu);
 	destroy_apu(&emu->apu);
+	destroy_pc_sampler(emu);
+	stop_trace(emu);
 }
 
 bool cartridge_loaded(Emulator* emu) {
 	return emu->mmu.cartridge.rom != NULL;
 }
 
+// The flavor the library was built as (see build_config.h), for frontends to check against their own.
+const char* core_flavor(void) {
+	return YOLAHBOY_FLAVOR;
+}
+
 void skip_bootrom(Emulator* emu) {
+	sync_flags(&emu->cpu);
 	emu->cpu.registers.a = 0x01;
 	emu->cpu.registers.f = 0xB0;
 	emu->cpu.registers.b = 0x00;
@@ -69,5 +367,5 @@ void skip_bootrom(Emulator* emu) {
 	emu->cpu.registers.sp = 0xFFFE;
 	emu->cpu.registers.pc = 0x0100;
 
-	emu->mmu.in_bios = false;
+	leave_bios(emu);
 }
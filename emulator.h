@@ -3,8 +3,14 @@
 #include "global_definitions.h"
 
 void update_emu_controller(Emulator* emu, Controller controller);
+void set_dispatch_mode(Emulator* emu, DispatchMode mode);
+void set_spin_loop_skip(Emulator* emu, bool enabled);
 int init_emulator(Emulator* emu, int sample_rate, int buffer_size);
+int init_emulator_timed(Emulator* emu, int sample_rate, int buffer_size, TimingMode timing);
 void destroy_emulator(Emulator* emu);
 int step(Emulator* emu);
+int run_cycles(Emulator* emu, int t_cycles);
+int run_frame(Emulator* emu);
 bool cartridge_loaded(Emulator* emu);
+const char* core_flavor(void);
 void skip_bootrom(Emulator* emu);
\ No newline at end of file
@@ -1,5 +1,7 @@
 #pragma once
 #include <stdbool.h>
+#include <stddef.h>
+#include "build_config.h"
 
 typedef unsigned char u8;
 typedef char i8;
@@ -7,12 +9,16 @@ typedef short i16;
 typedef unsigned short u16;
 typedef unsigned int u32;
 
+#ifdef ENABLE_DEBUGGER
 #define MAX_BREAKPOINTS 0x100
+#endif
 
 #define BANKSIZE 0x4000
 #define TITLE 0x134
 #define TITLE_SIZE 0x10
 #define CARTRIDGE_TYPE 0x147
+#define ROM_SIZE 0x148
+#define RAM_SIZE 0x149
 
 #define SCREEN_WIDTH 160
 #define SCREEN_HEIGHT 144
@@ -173,6 +179,7 @@ typedef struct _apu {
 
 	int buffer_size;
 	int buffer_position;
+	float prev_sample; // low pass filter state
 
 	u16 lfsr;
 	u8 lfsr_clock_shift;
@@ -219,8 +226,30 @@ typedef enum {
 #define BANKMODESIMPLE false
 #define BANKMODEADVANCED true
 
+typedef struct _aot Aot;
+
+// The file a ROM image was read from, as far as the platform can tell (known is false where it can't).
+typedef struct {
+	bool known;
+	unsigned long long device;
+	unsigned long long inode;
+	long long size;
+	long long mtime;
+} RomFileId;
+
+// A whole ROM file in memory, see mmu/rom_image.h.
 typedef struct {
+	u8* data;
+	size_t size; // bytes of data
+	size_t mapping; // length of the mmap behind data, 0 for a malloc'd copy
+	RomFileId file;
+} RomImage;
+
+typedef struct _stored_rom StoredRom;
+
+typedef struct _Cartridge {
 	u8* rom;
+	StoredRom* stored_rom; // shared image rom points into, see mmu/rom_store.h
 	u8* ram;
 	u8 type;
 	u16 rom_bank;
@@ -231,6 +260,14 @@ typedef struct {
 	bool banking_mode;
 	bool ram_enabled;
 	u8 cgb_flag;
+	Aot* aot; // compiled blocks for this ROM, see cpu/aot.h
+
+	// What the mapper registers currently select, kept up to date by the mapper's write handler (see
+	// mmu/cartridge.c). NULL where cart_read8 reads 0xFF.
+	u8* rom0_base; // 0x0000-0x3FFF
+	u8* romx_base; // 0x4000-0x7FFF
+	u8* sram_base; // 0xA000-0xBFFF, NULL while the RAM is disabled
+	void (*write)(struct _Cartridge* cart, u16 address, u8 data); // chosen by cart_set_mapper
 } Cartridge;
 
 typedef struct _Mmu {
@@ -238,6 +275,13 @@ typedef struct _Mmu {
 	u8* memory;
 	Cartridge cartridge;
 	bool in_bios;
+	u32 map_generation; // bumped whenever what 0x0000-0x7FFF maps to may have changed, for the code caches
+	u32 rom_loads; // bumped by every load_emu_rom, the same ROM can come back at the same address
+
+	// Host pointer to each 256-byte page for read8 and write8, NULL where the access needs a handler. Rebuilt
+	// on the spot by whatever changes the mapping: bank and RAM enable writes, loading, leaving the bios.
+	u8* read_pages[0x100];
+	u8* write_pages[0x100];
 } Mmu;
 
 typedef struct {
@@ -274,6 +318,52 @@ typedef struct {
 } Registers;
 
 
+typedef struct {
+	int m_cycles;
+	int t_cycles;
+} Cycles;
+
+typedef enum {
+	DISPATCH_THREADED, // per-opcode handler table
+	DISPATCH_SWITCH, // reference switch in cpu_step
+	DISPATCH_BLOCK_CACHE, // handler table fed from pre-decoded basic blocks
+	DISPATCH_JIT, // native code for hot blocks, block cache otherwise (needs ENABLE_JIT, see cpu/jit.h)
+	DISPATCH_AOT // blocks from a module compiled for the loaded ROM, block cache otherwise (see cpu/aot.h)
+} DispatchMode;
+
+// Host pointer to the code page PC is in, see cpu/fetch.h.
+typedef struct {
+	const u8* base; // byte at start
+	u16 start;
+	u16 length; // 0 when nothing is mapped
+	u32 generation; // mmu.map_generation it was mapped under
+} FetchWindow;
+
+// Instructions run and their t-cycles per opcode, with ENABLE_OPCODE_PROFILE (see cpu/profiler.h).
+typedef struct {
+	unsigned long long count[0x100];
+	unsigned long long t_cycles[0x100];
+	unsigned long long cb_count[0x100];
+	unsigned long long cb_t_cycles[0x100];
+} OpcodeProfile;
+
+typedef struct _block_cache BlockCache;
+typedef struct _jit Jit;
+typedef struct _sampler Sampler;
+typedef struct _trace Trace;
+
+// Last 8-bit ALU op whose flags haven't been worked out yet, with ENABLE_LAZY_FLAGS (see cpu/alu.h).
+typedef struct {
+	bool pending; // registers.f is stale until the flags are resolved
+	u8 type; // instruction_type
+	u8 x;
+	u8 y;
+	u8 result;
+	u8 set_mask;
+	u8 reset_mask;
+	u8 ignore_mask;
+} LazyFlags;
+
 typedef struct {
 	Registers registers;
 	bool halted;
@@ -281,12 +371,20 @@ typedef struct {
 	bool should_update_IME;
 	bool update_IME_value;
 	int update_IME_counter;
-} Cpu;
 
-typedef struct {
-	int m_cycles;
-	int t_cycles;
-} Cycles;
+	DispatchMode dispatch_mode;
+	Cycles extra_cycles; // taken branches and CB ops, added on top of the base opcode cycles
+	BlockCache* block_cache;
+	Jit* jit; // created on first use of DISPATCH_JIT
+	LazyFlags lazy_flags;
+	FetchWindow fetch;
+#ifdef ENABLE_OPCODE_PROFILE
+	OpcodeProfile profile;
+#endif
+
+	u8 pending_interrupts; // IF & IE, kept current by update_interrupts so finish_step only tests this
+	bool joypad_held; // a button selected through P1 is down, which keeps JOYPAD_INTERRUPT set in IF
+} Cpu;
 
 typedef enum {
 	HBLANK,
@@ -316,6 +414,45 @@ typedef struct _gpu {
 	bool drawtile;
 } Gpu;
 
+#define MAX_SPIN_LOOP_STEPS 16
+
+// Polling-loop skip-ahead, off by default (see set_spin_loop_skip and cpu/spin_loop.h).
+typedef struct {
+	bool enabled;
+	unsigned long long skipped_cycles; // t-cycles fast-forwarded so far
+
+	u16 head; // loop being watched, from head to the jump back at tail
+	u16 tail;
+	bool is_spin_loop;
+	Registers registers; // at the last jump back to head
+	int quiet_cycles; // from then to the first timer or PPU event, less any skipped since
+	int num_steps; // instructions since then, MAX_SPIN_LOOP_STEPS + 1 once there are too many to record
+	u8 step_cycles[MAX_SPIN_LOOP_STEPS];
+	int iteration_steps; // the last full iteration
+	u8 iteration_cycles[MAX_SPIN_LOOP_STEPS];
+} SpinLoop;
+
+// When memory accesses happen relative to the timer, PPU and APU, chosen per instance at init_emulator_timed.
+typedef enum {
+	TIMING_INSTRUCTION, // whole instructions, then the components for all their cycles (the default)
+	TIMING_MCYCLE // the components are brought up to each memory access's M-cycle (see cpu/timing.h)
+} TimingMode;
+
+typedef struct {
+	TimingMode mode;
+	bool in_instruction; // CPU memory accesses are being timed
+	int ticked; // t-cycles of the current instruction the components have already run
+	int next_access; // t-cycles into the instruction at which the next memory access happens
+} CycleTiming;
+
+// Why run_cycles or run_frame returned; more than one bit can be set.
+typedef enum {
+	RUN_BUDGET = 1 << 0, // the cycle budget is used up
+	RUN_FRAME = 1 << 1, // gpu.should_draw, a frame is ready in the framebuffer
+	RUN_AUDIO = 1 << 2, // apu.buffer_full, the sample buffer is ready
+	RUN_ERROR = 1 << 3 // an instruction failed, as when step() returns -1
+} RunStatus;
+
 typedef struct {
 	Cpu cpu;
 	Mmu mmu;
@@ -323,8 +460,14 @@ typedef struct {
 	Timer timer;
 	Apu apu;
 	Controller controller;
+	SpinLoop spin;
+	CycleTiming timing;
+	Trace* trace; // NULL unless start_trace was called (see cpu/trace.h)
+#ifdef ENABLE_PC_SAMPLER
+	Sampler* sampler; // NULL until set_pc_sampler (see cpu/sampler.h)
+#endif
 	
-	int clock;	
+	unsigned long long clock; // t-cycles run since init_emulator, skipped ones included
 	bool should_run;
 	bool should_draw;
 } Emulator;
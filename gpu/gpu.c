@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
 #include "../mmu/mmu.h"
 
 int init_gpu(Gpu* gpu) {
@@ -191,12 +192,13 @@ void destroy_gpu(Gpu* gpu) {
 
 void handle_oam(Emulator* emu) {
 	if (emu->gpu.should_stat_interrupt && emu->gpu.clock > 4) {
-		write8(emu, IF, read8(emu, IF) | STAT_INTERRUPT);
+		request_interrupt(emu, STAT_INTERRUPT);
 		emu->gpu.should_stat_interrupt = false;
 	}
 	if (emu->gpu.clock >= 80) {
 		emu->gpu.clock -= 80;
 		emu->gpu.mode = VRAM_ACCESS;
+		map_vram(emu);
 		write8(emu, IF, (read8(emu, IF) & ~(STAT_INTERRUPT))); // reset STAT interrupt on mode 3 enter. There is no stat interrupt for mode 3
 	}
 }
@@ -205,6 +207,7 @@ void handle_vram(Emulator* emu) {
 	if (emu->gpu.clock >= 172) {
 		emu->gpu.clock -= 172;
 		emu->gpu.mode = HBLANK;
+		map_vram(emu);
 		draw_line(emu);
 		if (emu->gpu.stat & (1 << 3)) {
 			emu->gpu.should_stat_interrupt = true;
@@ -214,7 +217,7 @@ void handle_vram(Emulator* emu) {
 
 void handle_hblank(Emulator* emu) {
 	if (emu->gpu.should_stat_interrupt && emu->gpu.clock > 4) {
-		write8(emu, IF, read8(emu, IF) | STAT_INTERRUPT);
+		request_interrupt(emu, STAT_INTERRUPT);
 		emu->gpu.should_stat_interrupt = false;
 	}
 	if (emu->gpu.clock >= 204) {
@@ -230,8 +233,7 @@ void handle_hblank(Emulator* emu) {
 			emu->gpu.stat &= ~(1 << 2);
 		}
 		if (emu->gpu.ly == 143) {
-			u8 interrupt = read8(emu, IF);
-			write8(emu, IF, interrupt | VBLANK_INTERRUPT);
+			request_interrupt(emu, VBLANK_INTERRUPT);
 			emu->gpu.mode = VBLANK;
 			if (emu->gpu.stat & (1 << 4)) {
 				emu->gpu.should_stat_interrupt = true;
@@ -249,7 +251,7 @@ void handle_hblank(Emulator* emu) {
 
 void handle_vblank(Emulator* emu) {
 	if (emu->gpu.should_stat_interrupt && emu->gpu.clock > 4) {
-		write8(emu, IF, read8(emu, IF) | STAT_INTERRUPT);
+		request_interrupt(emu, STAT_INTERRUPT);
 		emu->gpu.should_stat_interrupt = false;
 	}
 	if (emu->gpu.clock >= 456) {
@@ -259,7 +261,7 @@ void handle_vblank(Emulator* emu) {
 		if (emu->mmu.memory[LYC] == emu->gpu.ly) {
 			emu->gpu.stat |= (1 << 2);
 			if (read8(emu, STAT) & (1 << 6)) {
-				emu->mmu.memory[IF] |= STAT_INTERRUPT;
+				request_interrupt(emu, STAT_INTERRUPT);
 			}
 		}
 		else {
@@ -283,7 +285,7 @@ void handle_vblank(Emulator* emu) {
 			}
 
 			if (read8(emu, STAT) & (1 << 5)) { // mode 2 interrupt select
-				write8(emu, IF, read8(emu, IF) | STAT_INTERRUPT);
+				request_interrupt(emu, STAT_INTERRUPT);
 			}
 		}
 	}
@@ -314,3 +316,26 @@ void gpu_step(Emulator* emu, u8 cycles) {
 	}
 	emu->gpu.stat = (emu->gpu.stat & 0b11111100) | (emu->gpu.mode & 0b00000011);
 }
+
+// Cycles from now until gpu_step would next do more than count: a mode change or a delayed STAT interrupt.
+// INT_MAX with the LCD off.
+int gpu_next_event(Emulator* emu) {
+	if (!(emu->gpu.lcdc & (1 << 7))) {
+		return INT_MAX;
+	}
+	static const int mode_length[] = { [HBLANK] = 204, [VBLANK] = 456, [OAM_ACCESS] = 80, [VRAM_ACCESS] = 172 };
+	int cycles = mode_length[emu->gpu.mode] - emu->gpu.clock;
+	if (emu->gpu.should_stat_interrupt && emu->gpu.mode != VRAM_ACCESS && 5 - emu->gpu.clock < cycles) {
+		cycles = 5 - emu->gpu.clock;
+	}
+	return cycles;
+}
+
+// Same as gpu_step called every 4 cycles for t_cycles, as long as that stops short of gpu_next_event.
+void gpu_skip(Emulator* emu, int t_cycles) {
+	emu->gpu.should_draw = false;
+	if (emu->gpu.lcdc & (1 << 7)) {
+		emu->gpu.clock += t_cycles;
+		emu->gpu.stat = (emu->gpu.stat & 0b11111100) | (emu->gpu.mode & 0b00000011);
+	}
+}
@@ -1,6 +1,8 @@
 #include <stdlib.h>
 #include "cartridge.h"
+#ifdef ENABLE_DEBUGGER
 #include "../../debugger/imgui_custom_widget_wrapper.h"
+#endif
 
 #define BANK_SELECT_HIGH 0x7FFF
 #define BANK_SELECT_LOW 0x6000
@@ -11,207 +13,188 @@
 #define ROM_BANK_HIGH 0x3FFF
 #define ROM_BANK_LOW 0x2000
 
+// Reads go through the bases the mapper registers select, so there's nothing mapper specific left here.
 u8 cart_read8(Cartridge* cart, u16 address) {
-	switch (cart->type) {
-	case ROM_ONLY: {
-		if (address < 0x8000) {
-			return cart->rom[address];
-		}
-		return 0xFF;
+	u8* base = NULL;
+	if (address < 0x4000) {
+		base = cart->rom0_base;
+	}
+	else if (address < 0x8000) {
+		base = cart->romx_base;
+		address -= 0x4000;
+	}
+	else if (address >= 0xA000 && address < 0xC000) {
+		base = cart->sram_base;
+		address -= 0xA000;
+	}
+	return base != NULL ? base[address] : 0xFF;
+}
+
+// ROM bank cart_read8 would read address (0x0000-0x7FFF) from, or -1 if the mapper isn't supported.
+int cart_rom_bank(Cartridge* cart, u16 address) {
+	u8* base = address < 0x4000 ? cart->rom0_base : cart->romx_base;
+	if (base == NULL) {
+		return -1;
+	}
+	return (int)((base - cart->rom) / BANKSIZE);
+}
+
+// Host pointer to the byte cart_read8 would read at address (0x0000-0x7FFF), valid up to the end of its
+// 16KB bank, or NULL if there's no ROM or the mapper isn't supported.
+u8* cart_rom_base(Cartridge* cart, u16 address) {
+	u8* base = address < 0x4000 ? cart->rom0_base : cart->romx_base;
+	if (base == NULL) {
+		return NULL;
 	}
+	return base + (address & (BANKSIZE - 1));
+}
+
+static u8* rom_bank_base(Cartridge* cart, int bank) {
+	if (cart->rom == NULL || (bank + 1) * BANKSIZE > cart->rom_size) {
+		return NULL;
+	}
+	return cart->rom + bank * BANKSIZE;
+}
+
+static u8* ram_bank_base(Cartridge* cart) {
+	if (!cart->ram_enabled || cart->ram == NULL) { // if ram disabled reads return 0xFF
+		return NULL;
+	}
+	if (cart->banking_mode == BANKMODEADVANCED) {
+		int num_banks = cart->ram_size / 0x2000;
+		return cart->ram + (cart->ram_bank & (num_banks - 1)) * 0x2000;
+	}
+	return cart->ram;
+}
+
+// Selectable bank for MBC1 and MBC3, with the upper bits from ram_bank
+static u8 selected_rom_bank(Cartridge* cart) {
+	u8 current_bank = cart->rom_bank;
+	u8 num_banks = (cart->rom_size / BANKSIZE);
+	current_bank |= (cart->ram_bank << 5);
+	current_bank &= (num_banks - 1);
+	return current_bank;
+}
+
+// Recomputes the bases after a register write.
+static void update_banks(Cartridge* cart) {
+	switch (cart->type) {
+	case ROM_ONLY:
+		cart->rom0_base = rom_bank_base(cart, 0);
+		cart->romx_base = rom_bank_base(cart, 1);
+		cart->sram_base = NULL;
+		return;
 	case MBC1:
 	case MBC1_RAM:
 	case MBC1_RAM_BATTERY: {
-		if (address < 0x4000) { // bank 0
-			if (cart->banking_mode == BANKMODESIMPLE) {
-				return cart->rom[address];
-			}
-			else {
-				u8 current_bank = (cart->ram_bank << 5);
-				u8 num_banks = (cart->rom_size / BANKSIZE);
-				current_bank &= (num_banks - 1);
-				int offset = current_bank * BANKSIZE;
-				return cart->rom[offset + address];
-			}
-		}
-		if (address < 0x8000) { // selectable rom bank (this is working so far)
-			u8 current_bank = cart->rom_bank;
-			u8 num_banks = (cart->rom_size / BANKSIZE);
-			current_bank |= (cart->ram_bank << 5);
-			current_bank &= (num_banks - 1);
-
-			int offset = current_bank * BANKSIZE;
-			u16 newaddr = address - 0x4000;
-			return cart->rom[offset + newaddr];
-		}
-		if (address >= 0xA000 && address < 0xC000) { // ram read
-			if (cart->ram_enabled && cart->ram != NULL) {
-				int newaddr = address - 0xA000;
-				if (cart->banking_mode == BANKMODEADVANCED) {
-					int num_banks = cart->ram_size / 0x2000;
-					int current_bank = cart->ram_bank & (num_banks - 1);
-					int offset = (current_bank * 0x2000);
-					newaddr += offset;
-					return cart->ram[newaddr];
-				}
-				else {
-					return cart->ram[newaddr];
-				}
-			}
-			else { // if ram disabled return 0xFF
-				return 0xFF;
-			}
-		}
+		u8 num_banks = (cart->rom_size / BANKSIZE);
+		u8 bank0 = cart->banking_mode == BANKMODESIMPLE ? 0 : (u8)(cart->ram_bank << 5) & (num_banks - 1);
+		cart->rom0_base = rom_bank_base(cart, bank0);
+		cart->romx_base = rom_bank_base(cart, selected_rom_bank(cart));
+		cart->sram_base = ram_bank_base(cart);
+		return;
+	}
 	case 0x13:
 	case MBC3_TIMER_RAM_BATTERY:
 	case MBC3:
-		switch (address & 0xF000) {
-		case 0x0000:
-		case 0x1000:
-		case 0x2000:
-		case 0x3000:
-			return cart->rom[address];
-		case 0x4000:
-		case 0x5000:
-		case 0x6000:
-		case 0x7000:
-		{
-			u8 current_bank = cart->rom_bank;
-			u8 num_banks = (cart->rom_size / BANKSIZE);
-			current_bank |= (cart->ram_bank << 5);
-			current_bank &= (num_banks - 1);
-
-			int offset = current_bank * BANKSIZE;
-			u16 newaddr = address - 0x4000;
-			return cart->rom[offset + newaddr];
-		}
-		case 0xA000:
-		case 0xB000:
-			if (cart->ram_enabled && cart->ram != NULL) {
-				int newaddr = address - 0xA000;
-				if (cart->banking_mode == BANKMODEADVANCED) {
-					int num_banks = cart->ram_size / 0x2000;
-					int current_bank = cart->ram_bank & (num_banks - 1);
-					int offset = (current_bank * 0x2000);
-					newaddr += offset;
-					return cart->ram[newaddr];
-				}
-				else {
-					return cart->ram[newaddr];
-				}
-			}
-			else { // if ram disabled return 0xFF
-				return 0xFF;
-			}
-		}
+		cart->rom0_base = rom_bank_base(cart, 0);
+		cart->romx_base = rom_bank_base(cart, selected_rom_bank(cart));
+		cart->sram_base = ram_bank_base(cart);
+		return;
+	default:
+		cart->rom0_base = NULL;
+		cart->romx_base = NULL;
+		cart->sram_base = NULL;
+		return;
 	}
-	
+}
+
+static void set_ram_enabled(Cartridge* cart, u8 data) {
+	cart->ram_enabled = (data & 0x0F) == 0xA;
+}
+
+static void write_sram(Cartridge* cart, u16 address, u8 data) {
+	if (cart->sram_base != NULL) {
+		cart->sram_base[address - 0xA000] = data;
 	}
 }
 
-void cart_write8(Cartridge* cart, u16 address, u8 data) {
+// ROM only, and the mappers we don't support yet
+static void rom_only_write8(Cartridge* cart, u16 address, u8 data) {
+	if (address <= RAM_ENABLE_HIGH) {
+		set_ram_enabled(cart, data);
+	}
+}
 
-	if (address <= 0x1FFF) { // ram enable register
-		cart->ram_enabled = (data & 0x0F) == 0xA;
+static void mbc1_write8(Cartridge* cart, u16 address, u8 data) {
+	if (address <= RAM_ENABLE_HIGH) {
+		set_ram_enabled(cart, data);
+	}
+	else if (address <= ROM_BANK_HIGH) {
+		data = data & 0b00011111;
+		if (data == 0) data = 1;
+		cart->rom_bank = data;
+	}
+	else if (address <= RAM_BANK_HIGH) { // ram bank number or upper bits of rom bank number
+		cart->ram_bank = (data & 0b00000011);
+	}
+	else if (address <= BANK_SELECT_HIGH) {
+		cart->banking_mode = (data & 0b00000001) == 1 ? BANKMODEADVANCED : BANKMODESIMPLE;
+	}
+	else {
+		write_sram(cart, address, data);
 		return;
 	}
-	if (address >= 0x2000 && address <= 0x3FFF) { // rom bank number
-		switch (cart->type) {
-		case ROM_ONLY:
-			return;
-		case MBC1:
-		case MBC1_RAM:
-		case MBC1_RAM_BATTERY:
-			data = data & 0b00011111;
-			if (data == 0 || data == 0x20 || data == 0x40 || data == 0x60) data += 1;
-			cart->rom_bank = data;
-			return;
-		case 0x13:
-		case MBC3_TIMER_RAM_BATTERY:
-		case MBC3:
-			if (data == 0) data = 1;
-			cart->rom_bank = data;
-			return;
-		default:
-			return;
-		}
+	update_banks(cart);
+}
+
+static void mbc3_write8(Cartridge* cart, u16 address, u8 data) {
+	if (address <= RAM_ENABLE_HIGH) {
+		set_ram_enabled(cart, data);
 	}
-	if (address >= 0x4000 && address <= 0x5FFF) { // ram bank number or upper bits of rom bank number
-		switch (cart->type) {
-		case ROM_ONLY:
-			return;
-		case MBC1:
-		case MBC1_RAM:
-		case MBC1_RAM_BATTERY: {
-			cart->ram_bank = (data & 0b00000011);
-			return;
-		}
-		case 0x13:
-		case MBC3_TIMER_RAM_BATTERY:
-		case MBC3: {
-			if (data <= 3) {
-				cart->rom_bank = data;
-				return;
-			}
-			if (data >= 0x08 && data <= 0x0c) {
-				cart->rom_bank = RTC_REGISTER;
-				return;
-			}
-		}
-		}
+	else if (address <= ROM_BANK_HIGH) {
+		if (data == 0) data = 1;
+		cart->rom_bank = data;
 	}
-	if (address >= 0x6000 && address <= 0x7FFF) { // bank mode select
-		if (cart->type == ROM_ONLY) return;
-		switch (cart->type) {
-		case MBC1:
-		case MBC1_RAM:
-		case MBC1_RAM_BATTERY: {
-			if ((data & 0b00000001) == 1) {
-				cart->banking_mode = BANKMODEADVANCED;
-			}
-			else {
-				cart->banking_mode = BANKMODESIMPLE;
-			}
-			return;
+	else if (address <= RAM_BANK_HIGH) {
+		if (data <= 3) {
+			cart->rom_bank = data;
 		}
+		else if (data >= 0x08 && data <= 0x0c) {
+			cart->rom_bank = RTC_REGISTER;
 		}
-		if (address >= 0xA000 && address <= 0xBFFF) { // ram write
-			switch (cart->type) {
-			case ROM_ONLY:
-				return;
-			case MBC1:
-			case MBC1_RAM:
-			case MBC1_RAM_BATTERY: {
-				if (cart->ram_enabled && cart->ram != NULL) {
-					if (cart->banking_mode == BANKMODESIMPLE) {
-						int newaddr = address - 0xA000;
-						cart->ram[newaddr] = data;
-					}
-					else {
-						int num_banks = cart->ram_size / 0x2000;
-						int current_bank = cart->ram_bank & (num_banks - 1);
-						int offset = current_bank * 0x2000;
-						int newaddr = address - 0xA000;
-						cart->ram[offset + newaddr] = data;
-					}
-				}
+	}
+	else if (address <= BANK_SELECT_HIGH) {
+		return;
+	}
+	else {
+		write_sram(cart, address, data);
+		return;
+	}
+	update_banks(cart);
+}
 
-			}
-			case 0x13:
-			case MBC3:
-			case MBC3_TIMER_RAM_BATTERY: {
-				if (cart->ram_enabled && cart->ram != NULL) {
-					if (cart->ram_bank != RTC_REGISTER) {
-						int newaddr = address - 0xA000;
-						int num_banks = cart->ram_size / 0x2000;
-						int current_bank = cart->ram_bank & (num_banks - 1);
-						int offset = current_bank * 0x2000;
-						cart->ram[offset + newaddr] = data;
-					}
-				}
-			}
-			}
-		}
+// Picks the write handler for cart->type and maps the initial banks. Needed whenever the type, ROM or RAM
+// change.
+void cart_set_mapper(Cartridge* cart) {
+	switch (cart->type) {
+	case MBC1:
+	case MBC1_RAM:
+	case MBC1_RAM_BATTERY:
+		cart->write = mbc1_write8;
+		break;
+	case 0x13:
+	case MBC3_TIMER_RAM_BATTERY:
+	case MBC3:
+		cart->write = mbc3_write8;
+		break;
+	default:
+		cart->write = rom_only_write8;
+		break;
 	}
+	update_banks(cart);
 }
 
+void cart_write8(Cartridge* cart, u16 address, u8 data) {
+	cart->write(cart, address, data);
+}
@@ -2,4 +2,7 @@
 #include "../global_definitions.h"
 
 u8 cart_read8(Cartridge* cart, u16 address);
-void cart_write8(Cartridge* cart, u16 address, u8 data);
\ No newline at end of file
+void cart_write8(Cartridge* cart, u16 address, u8 data);
+int cart_rom_bank(Cartridge* cart, u16 address);
+u8* cart_rom_base(Cartridge* cart, u16 address);
+void cart_set_mapper(Cartridge* cart);
\ No newline at end of file
@@ -0,0 +1,320 @@
+#include "io.h"
+#include "mmu.h"
+#include "../apu/apu.h"
+#include "../controller/controller.h"
+#include "../cpu/block_cache.h"
+
+static u8 read_memory(Emulator* emu, u16 address) {
+	return emu->mmu.memory[address];
+}
+
+static u8 read_joypad(Emulator* emu, u16 address) {
+	return joypad_return(emu->controller, emu->mmu.memory[address]);
+}
+
+// GPU registers
+static u8 read_lcdc(Emulator* emu, u16 address) { return emu->gpu.lcdc; }
+static u8 read_stat(Emulator* emu, u16 address) { return emu->gpu.stat; }
+static u8 read_scy(Emulator* emu, u16 address) { return emu->gpu.scy; }
+static u8 read_scx(Emulator* emu, u16 address) { return emu->gpu.scx; }
+static u8 read_ly(Emulator* emu, u16 address) { return emu->gpu.ly; }
+static u8 read_lyc(Emulator* emu, u16 address) { return emu->gpu.lyc; }
+static u8 read_wy(Emulator* emu, u16 address) { return emu->gpu.wy; }
+static u8 read_wx(Emulator* emu, u16 address) { return emu->gpu.wx; }
+
+// APU registers
+static u8 read_nr52(Emulator* emu, u16 address) { return emu->apu.nr52; }
+
+static void write_memory(Emulator* emu, u16 address, u8 data) {
+	emu->mmu.memory[address] = data;
+}
+
+static void write_ignored(Emulator* emu, u16 address, u8 data) {
+}
+
+static void write_joypad(Emulator* emu, u16 address, u8 data) {
+	emu->mmu.memory[address] = data;
+	update_joypad(emu);
+}
+
+static void write_div(Emulator* emu, u16 address, u8 data) {
+	emu->mmu.memory[address] = 0;
+	emu->timer.clock = 0;
+}
+
+static void write_if(Emulator* emu, u16 address, u8 data) {
+	emu->mmu.memory[address] = data;
+	update_interrupts(emu);
+}
+
+static void write_dma(Emulator* emu, u16 address, u8 data) {
+	data &= 0xDF;
+	u16 src_addr = data << 8;
+	for (int i = 0; i < 0x9F; ++i) {
+		emu->mmu.memory[0xFE00 + i] = emu->mmu.memory[src_addr + i];
+	}
+}
+
+// GPU registers
+static void write_lcdc(Emulator* emu, u16 address, u8 data) {
+	if ((data & (1 << 7)) == 0) {
+		emu->gpu.stat &= 0b11111000;
+		emu->gpu.ly = 0;
+		emu->gpu.mode = 0;
+		emu->gpu.clock = 0;
+		map_vram(emu);
+	}
+	emu->gpu.lcdc = data;
+}
+
+static void write_stat(Emulator* emu, u16 address, u8 data) {
+	emu->gpu.stat = data & 0b11111100;
+}
+
+// These are kept in mmu.memory as well.
+static void write_scy(Emulator* emu, u16 address, u8 data) { emu->gpu.scy = data; write_memory(emu, address, data); }
+static void write_scx(Emulator* emu, u16 address, u8 data) { emu->gpu.scx = data; write_memory(emu, address, data); }
+static void write_lyc(Emulator* emu, u16 address, u8 data) { emu->gpu.lyc = data; write_memory(emu, address, data); }
+static void write_wy(Emulator* emu, u16 address, u8 data) { emu->gpu.wy = data; write_memory(emu, address, data); }
+static void write_wx(Emulator* emu, u16 address, u8 data) { emu->gpu.wx = data; write_memory(emu, address, data); }
+
+// APU registers. While the APU is off, writes to them are just stored.
+static bool apu_off(Emulator* emu, u16 address, u8 data) {
+	if (emu->apu.nr52 & 0b10000000) {
+		return false;
+	}
+	write_memory(emu, address, data);
+	return true;
+}
+
+static void write_nr52(Emulator* emu, u16 address, u8 data) {
+	emu->apu.nr52 = data & 0b10000000;
+}
+
+static void write_nr51(Emulator* emu, u16 address, u8 data) {
+	if (apu_off(emu, address, data)) return;
+	emu->apu.nr51 = data;
+}
+
+static void write_nr11(Emulator* emu, u16 address, u8 data) {
+	if (apu_off(emu, address, data)) return;
+	emu->apu.channel[0].wave_select = (data & 0b11000000) >> 6;
+	emu->apu.channel[0].length = data & 0b0011111;
+}
+
+static void write_nr12(Emulator* emu, u16 address, u8 data) {
+	if (apu_off(emu, address, data)) return;
+	emu->apu.nr12 = data;
+	emu->apu.channel[0].env_initial_volume = (data & 0b11110000) >> 4;
+	emu->apu.channel[0].env_dir = data & 0b00001000;
+	emu->apu.channel[0].env_sweep_pace = data & 0b00000111;
+	emu->apu.channel[0].dac_enable = data & 0b11111000;
+}
+
+static void write_nr13(Emulator* emu, u16 address, u8 data) {
+	if (apu_off(emu, address, data)) return;
+	emu->apu.nr13 = data;
+	int frequency = (emu->apu.nr13) | ((emu->apu.nr14 & 0b00000111) << 8);
+	frequency = (2048 - frequency) * 4;
+	emu->apu.channel[0].frequency = frequency;
+}
+
+static void write_nr14(Emulator* emu, u16 address, u8 data) {
+	if (apu_off(emu, address, data)) return;
+	emu->apu.nr14 = data;
+	int frequency = (emu->apu.nr13) | ((emu->apu.nr14 & 0b00000111) << 8);
+	frequency = (2048 - frequency) * 4;
+	emu->apu.channel[0].frequency = frequency;
+	emu->apu.channel[0].length_enabled = data & 0b01000000;
+	if (data & 0b10000000) {
+		emu->apu.channel[0].wave_index = 0;
+		trigger_channel(&emu->apu.channel[0]);
+	}
+}
+
+static void write_nr21(Emulator* emu, u16 address, u8 data) {
+	if (apu_off(emu, address, data)) return;
+	emu->apu.nr21 = data;
+	emu->apu.channel[1].wave_select = (data & 0b11000000) >> 6;
+	emu->apu.channel[1].length = data & 0b0011111;
+}
+
+static void write_nr22(Emulator* emu, u16 address, u8 data) {
+	if (apu_off(emu, address, data)) return;
+	emu->apu.nr22 = data;
+	emu->apu.channel[1].env_initial_volume = (data & 0b11110000) >> 4;
+	emu->apu.channel[1].env_dir = data & 0b00001000;
+	emu->apu.channel[1].env_sweep_pace = data & 0b00000111;
+	emu->apu.channel[1].dac_enable = data & 0b11111000;
+}
+
+static void write_nr23(Emulator* emu, u16 address, u8 data) {
+	if (apu_off(emu, address, data)) return;
+	emu->apu.nr23 = data;
+	int frequency = (emu->apu.nr23) | ((emu->apu.nr24 & 0b00000111) << 8);
+	frequency = (2048 - frequency) * 4;
+	emu->apu.channel[1].frequency = frequency;
+}
+
+static void write_nr24(Emulator* emu, u16 address, u8 data) {
+	if (apu_off(emu, address, data)) return;
+	emu->apu.nr24 = data;
+	int frequency = (emu->apu.nr23) | ((emu->apu.nr24 & 0b00000111) << 8);
+	frequency = (2048 - frequency) * 4;
+	emu->apu.channel[1].frequency = frequency;
+	emu->apu.channel[1].length_enabled = data & 0b01000000;
+	if (data & 0b10000000) {
+		emu->apu.channel[1].wave_index = 0;
+		trigger_channel(&emu->apu.channel[1]);
+	}
+}
+
+static void write_nr30(Emulator* emu, u16 address, u8 data) {
+	if (apu_off(emu, address, data)) return;
+	bool enabled = data & 0x80;
+	emu->apu.nr30 = data & 0x80;
+	emu->apu.channel[2].dac_enable = enabled;
+}
+
+static void write_nr31(Emulator* emu, u16 address, u8 data) {
+	if (apu_off(emu, address, data)) return;
+	emu->apu.nr31 = data;
+	emu->apu.channel[2].length = data;
+}
+
+static void write_nr32(Emulator* emu, u16 address, u8 data) {
+	if (apu_off(emu, address, data)) return;
+	emu->apu.nr32 = data;
+	emu->apu.channel[2].volume = (data & 0b01100000) >> 5;
+}
+
+static void write_nr33(Emulator* emu, u16 address, u8 data) {
+	if (apu_off(emu, address, data)) return;
+	emu->apu.nr33 = data;
+	int frequency = (emu->apu.nr33) | ((emu->apu.nr34 & 0b00000111) << 8);
+	frequency = (2048 - frequency) * 2;
+	emu->apu.channel[2].frequency = frequency;
+}
+
+static void write_nr34(Emulator* emu, u16 address, u8 data) {
+	if (apu_off(emu, address, data)) return;
+	emu->apu.nr34 = data;
+	int frequency = (emu->apu.nr33) | ((emu->apu.nr34 & 0b00000111) << 8);
+	frequency = (2048 - frequency) * 2;
+	emu->apu.channel[2].frequency = frequency;
+	emu->apu.channel[2].length_enabled = data & 0b01000000;
+	if (data & 0b10000000) {
+		emu->apu.channel[2].wave_index = 1;
+		emu->apu.channel[2].env_dir = true;
+		trigger_channel(&emu->apu.channel[2]);
+	}
+}
+
+static void write_wave_ram(Emulator* emu, u16 address, u8 data) {
+	if (apu_off(emu, address, data)) return;
+	emu->apu.wave_pattern_ram[address - 0xFF30] = data;
+}
+
+// Also kept in mmu.memory, whether the APU is on or not.
+static void write_nr41(Emulator* emu, u16 address, u8 data) {
+	if (apu_off(emu, address, data)) return;
+	emu->apu.nr41 = data;
+	emu->apu.channel[3].length = data & 0b0011111;
+	write_memory(emu, address, data);
+}
+
+static void write_nr42(Emulator* emu, u16 address, u8 data) {
+	if (apu_off(emu, address, data)) return;
+	emu->apu.nr42 = data;
+	emu->apu.channel[3].env_initial_volume = (data & 0b11110000) >> 4;
+	emu->apu.channel[3].env_dir = data & 0b00001000;
+	emu->apu.channel[3].env_sweep_pace = data & 0b00000111;
+	emu->apu.channel[3].dac_enable = data & 0b11111000;
+}
+
+static void write_nr43(Emulator* emu, u16 address, u8 data) {
+	if (apu_off(emu, address, data)) return;
+	emu->apu.nr43 = data;
+	u8 clock_shift = ((data & 0xF0) >> 4);
+	bool width = data & 0x8;
+	u8 divider = data & 0x7;
+	emu->apu.lfsr_clock_shift = clock_shift;
+	emu->apu.lfsr_width = width;
+	emu->apu.lfsr_clock_divider = divider;
+	emu->apu.channel[3].frequency = (divider > 0 ? (divider << 4) : 8) << clock_shift;
+}
+
+static void write_nr44(Emulator* emu, u16 address, u8 data) {
+	if (apu_off(emu, address, data)) return;
+	emu->apu.nr44 = data;
+	emu->apu.channel[3].length_enabled = data & 0b01000000;
+	if (data & 0b10000000) {
+		emu->apu.lfsr = 0xFFFF;
+		trigger_channel(&emu->apu.channel[3]);
+	}
+}
+
+// Indexed by address - 0xFF00.
+const io_read_handler io_read_handlers[0x80] = {
+	read_joypad, read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, // FF00
+	read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, // FF08
+	read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, // FF10
+	read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, // FF18
+	read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, read_nr52,   read_memory, // FF20
+	read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, // FF28
+	read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, // FF30
+	read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, // FF38
+	read_lcdc,   read_stat,   read_scy,    read_scx,    read_ly,     read_lyc,    read_memory, read_memory, // FF40
+	read_memory, read_memory, read_wy,     read_wx,     read_memory, read_memory, read_memory, read_memory, // FF48
+	read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, // FF50
+	read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, // FF58
+	read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, // FF60
+	read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, // FF68
+	read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, // FF70
+	read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, read_memory, // FF78
+};
+
+const io_write_handler io_write_handlers[0x80] = {
+	write_joypad,   write_memory,   write_memory,   write_memory,   write_div,      write_memory,   write_memory,   write_memory,   // FF00
+	write_memory,   write_memory,   write_memory,   write_memory,   write_memory,   write_memory,   write_memory,   write_if,       // FF08
+	write_memory,   write_nr11,     write_nr12,     write_nr13,     write_nr14,     write_memory,   write_nr21,     write_nr22,     // FF10
+	write_nr23,     write_nr24,     write_nr30,     write_nr31,     write_nr32,     write_nr33,     write_nr34,     write_memory,   // FF18
+	write_nr41,     write_nr42,     write_nr43,     write_nr44,     write_memory,   write_nr51,     write_nr52,     write_memory,   // FF20
+	write_memory,   write_memory,   write_memory,   write_memory,   write_memory,   write_memory,   write_memory,   write_memory,   // FF28
+	write_wave_ram, write_wave_ram, write_wave_ram, write_wave_ram, write_wave_ram, write_wave_ram, write_wave_ram, write_wave_ram, // FF30
+	write_wave_ram, write_wave_ram, write_wave_ram, write_wave_ram, write_wave_ram, write_wave_ram, write_wave_ram, write_wave_ram, // FF38
+	write_lcdc,     write_stat,     write_scy,      write_scx,      write_ignored,  write_lyc,      write_dma,      write_memory,   // FF40
+	write_memory,   write_memory,   write_wy,       write_wx,       write_memory,   write_memory,   write_memory,   write_memory,   // FF48
+	write_memory,   write_memory,   write_memory,   write_memory,   write_memory,   write_memory,   write_memory,   write_memory,   // FF50
+	write_memory,   write_memory,   write_memory,   write_memory,   write_memory,   write_memory,   write_memory,   write_memory,   // FF58
+	write_memory,   write_memory,   write_memory,   write_memory,   write_memory,   write_memory,   write_memory,   write_memory,   // FF60
+	write_memory,   write_memory,   write_memory,   write_memory,   write_memory,   write_memory,   write_memory,   write_memory,   // FF68
+	write_memory,   write_memory,   write_memory,   write_memory,   write_memory,   write_memory,   write_memory,   write_memory,   // FF70
+	write_memory,   write_memory,   write_memory,   write_memory,   write_memory,   write_memory,   write_memory,   write_memory,   // FF78
+};
+
+// Any address in 0xFF00-0xFFFF.
+u8 io_read8(Emulator* emu, u16 address) {
+	if (address < 0xFF80) {
+		return io_read_handlers[address - 0xFF00](emu, address);
+	}
+	return emu->mmu.memory[address]; // hram and IE
+}
+
+void io_write8(Emulator* emu, u16 address, u8 data) {
+	if (address < 0xFF80) {
+		io_write_handlers[address - 0xFF00](emu, address, data);
+	}
+	else if (address < 0xFFFF) {
+		// hram
+		emu->mmu.memory[address] = data;
+		if (is_cached_code(emu->cpu.block_cache, address)) {
+			invalidate_code(emu->cpu.block_cache, address);
+		}
+	}
+	else {
+		// IE
+		emu->mmu.memory[address] = data;
+		update_interrupts(emu);
+	}
+}
@@ -0,0 +1,16 @@
+#pragma once
+#include "../global_definitions.h"
+
+// Handlers for the 0xFF00-0xFFFF page. Each I/O register from 0xFF00 to 0xFF7F has a read and a write
+// handler in io_read_handlers and io_write_handlers, so a register access is one indirect call; registers
+// with nothing behind them are plain storage in mmu.memory. io_read8 and io_write8 dispatch the whole page,
+// HRAM and IE included. New registers only need their table entries changed.
+
+typedef u8 (*io_read_handler)(Emulator* emu, u16 address);
+typedef void (*io_write_handler)(Emulator* emu, u16 address, u8 data);
+
+extern const io_read_handler io_read_handlers[0x80];
+extern const io_write_handler io_write_handlers[0x80];
+
+u8 io_read8(Emulator* emu, u16 address);
+void io_write8(Emulator* emu, u16 address, u8 data);
@@ -2,9 +2,14 @@
 #include <stdlib.h>
 #include <string.h>
 #include "Mmu.h"
-#include "../apu/apu.h"
 #include "../controller/controller.h"
 #include "./cartridge.h"
+#include "./rom_store.h"
+#include "./io.h"
+#include "../cpu/block_cache.h"
+#include "../cpu/aot.h"
+#include "../cpu/trace.h"
+#include "../cpu/timing.h"
 
 void init_mmu(Mmu* mem) {
 	memset(mem, 0, sizeof(Mmu));
@@ -14,6 +19,7 @@ void init_mmu(Mmu* mem) {
 	mem->cartridge.ram_bank = 0;
 	mem->cartridge.banking_mode = BANKMODESIMPLE;
 	mem->cartridge.ram_enabled = false;
+	cart_set_mapper(&mem->cartridge);
 
 	mem->memory = (u8*)calloc(0x10000, sizeof(u8));
 	if (mem->memory == NULL) {
@@ -24,9 +30,73 @@ void init_mmu(Mmu* mem) {
 		return;
 	}
 	mem->in_bios = true;
+	map_pages(mem);
 }
 
-u8 read8(Emulator* emu, u16 address) {
+// Maps the 0x0000-0x7FFF ROM pages (the bios over page 0 while it's in) for reading, and the cartridge RAM
+// pages while the RAM is enabled. ROM writes always go to cart_write8.
+static void map_cartridge(Mmu* mem) {
+	Cartridge* cart = &mem->cartridge;
+	for (int page = 0x00; page < 0x40; ++page) {
+		mem->read_pages[page] = cart->rom0_base != NULL ? cart->rom0_base + (page << 8) : NULL;
+		mem->read_pages[page + 0x40] = cart->romx_base != NULL ? cart->romx_base + (page << 8) : NULL;
+	}
+	if (mem->in_bios) {
+		mem->read_pages[0x00] = mem->bios;
+	}
+	for (int page = 0xA0; page < 0xC0; ++page) {
+		u8* sram = cart->sram_base != NULL ? cart->sram_base + ((page - 0xA0) << 8) : NULL;
+		mem->read_pages[page] = mem->write_pages[page] = sram;
+	}
+}
+
+// Unmaps the bios once it has run up to 0x100.
+void leave_bios(Emulator* emu) {
+	emu->mmu.in_bios = false;
+	++emu->mmu.map_generation;
+	map_cartridge(&emu->mmu);
+}
+
+// Builds the page tables from scratch. Pages left NULL go through io_read8 and io_write8 (I/O, HRAM and IE)
+// or read_special and write_special: cartridge registers, disabled cartridge RAM, and the bits of echo RAM
+// and OAM write8 drops.
+void map_pages(Mmu* mem) {
+	for (int page = 0; page < 0x100; ++page) {
+		mem->read_pages[page] = NULL;
+		mem->write_pages[page] = NULL;
+	}
+	for (int page = 0x80; page < 0xA0; ++page) { // vram
+		mem->read_pages[page] = mem->write_pages[page] = mem->memory + (page << 8);
+	}
+	for (int page = 0xC0; page < 0xE0; ++page) { // wram
+		mem->read_pages[page] = mem->write_pages[page] = mem->memory + (page << 8);
+	}
+	for (int page = 0xE0; page < 0xF0; ++page) { // echo reads come from wram, writes stay put
+		mem->read_pages[page] = mem->memory + ((page - 0x20) << 8);
+		mem->write_pages[page] = mem->memory + (page << 8);
+	}
+	for (int page = 0xF0; page < 0xFF; ++page) {
+		mem->read_pages[page] = mem->memory + (page << 8);
+	}
+	map_cartridge(mem);
+}
+
+// VRAM can't be written while the PPU is drawing, so its write pages follow gpu.mode.
+void map_vram(Emulator* emu) {
+	u8* vram = emu->gpu.mode != 3 ? emu->mmu.memory + 0x8000 : NULL;
+	for (int page = 0x80; page < 0xA0; ++page) {
+		emu->mmu.write_pages[page] = vram != NULL ? vram + ((page - 0x80) << 8) : NULL;
+	}
+}
+
+// WRAM pages holding cached code go through write_special, which drops the blocks a write lands in.
+void map_wram(Emulator* emu) {
+	for (int page = 0xC0; page < 0xE0; ++page) {
+		emu->mmu.write_pages[page] = page_has_code(emu->cpu.block_cache, page) ? NULL : emu->mmu.memory + (page << 8);
+	}
+}
+
+static u8 read_special(Emulator* emu, u16 address) {
 	Mmu* mem = &emu->mmu;
 	switch (address & 0xF000) {
 	case 0x0000:
@@ -50,30 +120,24 @@ u8 read8(Emulator* emu, u16 address) {
 	case 0xE000:
 		return mem->memory[address - 0x2000];
 
-	case 0xF000:
-		if (address >= 0xFF00 && address <= 0xFFFE) {
-			if (address == 0xFF00) {
-				return joypad_return(emu->controller, mem->memory[address]);
-			}
-
-			// GPU registers
-			if (address == STAT) return emu->gpu.stat;
-			if (address == LCDC) return emu->gpu.lcdc;
-			if (address == LY) return emu->gpu.ly;
-			if (address == LYC) return emu->gpu.lyc;
-			if (address == SCY) return emu->gpu.scy;
-			if (address == SCX) return emu->gpu.scx;
-			if (address == WY) return emu->gpu.wy;
-			if (address == WX) return emu->gpu.wx;
-
-			// APU registers
-			if (address == NR52) return emu->apu.nr52;
-		}
-		// fall through
 	default:
 		return mem->memory[address];
 	}
 }
+
+u8 read8(Emulator* emu, u16 address) {
+	Mmu* mem = &emu->mmu;
+	timed_access(emu);
+	u8* page = mem->read_pages[address >> 8];
+	if (page != NULL) {
+		return page[address & 0xFF];
+	}
+	if (address >= 0xFF00) {
+		return io_read8(emu, address);
+	}
+	return read_special(emu, address);
+}
+
 u16 read16(Emulator* emu, u16 address) {
 	u16 ret = 0;
 	ret |= read8(emu, address);
@@ -86,7 +150,7 @@ void write16(Emulator* emu, u16 address, u16 value) {
 	write8(emu, address + 1, value >> 8);
 }
 
-void write8(Emulator* emu, u16 address, u8 data) {
+static void write_special(Emulator* emu, u16 address, u8 data) {
 	Mmu* mem = &emu->mmu;
 	switch (address & 0xF000) {
 	case 0x0000:
@@ -99,6 +163,9 @@ void write8(Emulator* emu, u16 address, u8 data) {
 	case 0x7000:
 		// cartridge rom
 		cart_write8(&mem->cartridge, address, data);
+		++mem->map_generation;
+		map_cartridge(mem);
+		drop_block_cursor(emu->cpu.block_cache);
 		return;
 
 	case 0x8000:
@@ -119,6 +186,9 @@ void write8(Emulator* emu, u16 address, u8 data) {
 	case 0xD000:
 		// wram
 		mem->memory[address] = data;
+		if (is_cached_code(emu->cpu.block_cache, address)) {
+			invalidate_code(emu->cpu.block_cache, address);
+		}
 		return;
 
 	case 0xE000:
@@ -137,225 +207,46 @@ void write8(Emulator* emu, u16 address, u8 data) {
 			mem->memory[address] = data;
 			return;
 		}
-		else if (address >= 0xFF00 && address <= 0xFF7F) {
-			// IO Registers
-			if (address == DMA) {
-				data &= 0xDF;
-				u16 src_addr = data << 8;
-				for (int i = 0; i < 0x9F; ++i) {
-					mem->memory[0xFE00 + i] = mem->memory[src_addr + i];
-				}
-				return;
-			}
-
-			if (address == 0xFF02 && data == 0x81) {
-			}
+		break;
+	}
+}
 
-			if (address == DIV) {
-				mem->memory[address] = 0;
-				emu->timer.clock = 0;
-				return;
-			}
+void write8(Emulator* emu, u16 address, u8 data) {
+	Mmu* mem = &emu->mmu;
+	timed_access(emu);
+	trace_write(emu, address, data);
+	u8* page = mem->write_pages[address >> 8];
+	if (page != NULL) {
+		page[address & 0xFF] = data;
+		return;
+	}
+	if (address >= 0xFF00) {
+		io_write8(emu, address, data);
+		return;
+	}
+	write_special(emu, address, data);
+}
 
-			// GPU registers
-			if (address == LCDC) {
-				if ((data & (1 << 7)) == 0) {
-					emu->gpu.stat &= 0b11111000;
-					emu->gpu.ly = 0;
-					emu->gpu.mode = 0;
-					emu->gpu.clock = 0;
-				}
-				emu->gpu.lcdc = data;
-				return;
-			}
-			if (address == STAT) {
-				emu->gpu.stat = data & 0b11111100;
-				return;
-			}
-			if (address == LYC) emu->gpu.lyc = data;
-			if (address == LY) return;
-			if (address == SCY) emu->gpu.scy = data;
-			if (address == SCX) emu->gpu.scx = data;
-			if (address == WY) emu->gpu.wy = data;
-			if (address == WX) emu->gpu.wx = data;
-			if (address == BGP) {
-				// Handle BGP register
-			}
+// Sets a bit in IF, for components raising an interrupt.
+void request_interrupt(Emulator* emu, u8 flag) {
+	emu->mmu.memory[IF] |= flag;
+	emu->cpu.pending_interrupts = emu->mmu.memory[IF] & emu->mmu.memory[IE];
+}
 
-			// APU registers
-			if (address == NR52) {
-				emu->apu.nr52 = data & 0b10000000;
-				return;
-			}
-			if (emu->apu.nr52 & 0b10000000) {
-				if (address == NR51) {
-					emu->apu.nr51 = data;
-					return;
-				}
-				if (address == NR11) {
-					emu->apu.channel[0].wave_select = (data & 0b11000000) >> 6;
-					emu->apu.channel[0].length = data & 0b0011111;
-					return;
-				}
-				if (address == NR12) {
-					emu->apu.nr12 = data;
-					emu->apu.channel[0].env_initial_volume = (data & 0b11110000) >> 4;
-					emu->apu.channel[0].env_dir = data & 0b00001000;
-					emu->apu.channel[0].env_sweep_pace = data & 0b00000111;
-					emu->apu.channel[0].dac_enable = data & 0b11111000;
-					return;
-				}
-				if (address == NR13) {
-					emu->apu.nr13 = data;
-					int frequency = (emu->apu.nr13) | ((emu->apu.nr14 & 0b00000111) << 8);
-					frequency = (2048 - frequency) * 4;
-					emu->apu.channel[0].frequency = frequency;
-					return;
-				}
-				if (address == NR14) {
-					emu->apu.nr14 = data;
-					int frequency = (emu->apu.nr13) | ((emu->apu.nr14 & 0b00000111) << 8);
-					frequency = (2048 - frequency) * 4;
-					emu->apu.channel[0].frequency = frequency;
-					emu->apu.channel[0].length_enabled = data & 0b01000000;
-					if (data & 0b10000000) {
-						emu->apu.channel[0].wave_index = 0;
-						trigger_channel(&emu->apu.channel[0]);
-					}
-					return;
-				}
-				if (address == NR21) {
-					emu->apu.nr21 = data;
-					emu->apu.channel[1].wave_select = (data & 0b11000000) >> 6;
-					emu->apu.channel[1].length = data & 0b0011111;
-					return;
-				}
-				if (address == NR22) {
-					emu->apu.nr22 = data;
-					emu->apu.channel[1].env_initial_volume = (data & 0b11110000) >> 4;
-					emu->apu.channel[1].env_dir = data & 0b00001000;
-					emu->apu.channel[1].env_sweep_pace = data & 0b00000111;
-					emu->apu.channel[1].dac_enable = data & 0b11111000;
-					return;
-				}
-				if (address == NR23) {
-					emu->apu.nr23 = data;
-					int frequency = (emu->apu.nr23) | ((emu->apu.nr24 & 0b00000111) << 8);
-					frequency = (2048 - frequency) * 4;
-					emu->apu.channel[1].frequency = frequency;
-					return;
-				}
-				if (address == NR24) {
-					emu->apu.nr24 = data;
-					int frequency = (emu->apu.nr23) | ((emu->apu.nr24 & 0b00000111) << 8);
-					frequency = (2048 - frequency) * 4;
-					emu->apu.channel[1].frequency = frequency;
-					emu->apu.channel[1].length_enabled = data & 0b01000000;
-					if (data & 0b10000000) {
-						emu->apu.channel[1].wave_index = 0;
-						trigger_channel(&emu->apu.channel[1]);
-					}
-					return;
-				}
-				if (address == NR30) {
-					bool enabled = data & 0x80;
-					emu->apu.nr30 = data & 0x80;
-					emu->apu.channel[2].dac_enable = enabled;
-					return;
-				}
-				if (address == NR31) {
-					emu->apu.nr31 = data;
-					emu->apu.channel[2].length = data;
-					return;
-				}
-				if (address == NR32) {
-					emu->apu.nr32 = data;
-					emu->apu.channel[2].volume = (data & 0b01100000) >> 5;
-					return;
-				}
-				if (address == NR33) {
-					emu->apu.nr33 = data;
-					int frequency = (emu->apu.nr33) | ((emu->apu.nr34 & 0b00000111) << 8);
-					frequency = (2048 - frequency) * 2;
-					emu->apu.channel[2].frequency = frequency;
-					return;
-				}
-				if (address == NR34) {
-					emu->apu.nr34 = data;
-					int frequency = (emu->apu.nr33) | ((emu->apu.nr34 & 0b00000111) << 8);
-					frequency = (2048 - frequency) * 2;
-					emu->apu.channel[2].frequency = frequency;
-					emu->apu.channel[2].length_enabled = data & 0b01000000;
-					if (data & 0b10000000) {
-						emu->apu.channel[2].wave_index = 1;
-						emu->apu.channel[2].env_dir = true;
-						trigger_channel(&emu->apu.channel[2]);
-					}
-					return;
-				}
-				if (address >= 0xFF30 && address <= 0xFF3F) {
-					emu->apu.wave_pattern_ram[address - 0xFF30] = data;
-					return;
-				}
-				if (address == NR41) {
-					emu->apu.nr41 = data;
-					emu->apu.channel[3].length = data & 0b0011111;
-				}
-				if (address == NR42) {
-					emu->apu.nr42 = data;
-					emu->apu.channel[3].env_initial_volume = (data & 0b11110000) >> 4;
-					emu->apu.channel[3].env_dir = data & 0b00001000;
-					emu->apu.channel[3].env_sweep_pace = data & 0b00000111;
-					emu->apu.channel[3].dac_enable = data & 0b11111000;
-					return;
-				}
-				if (address == NR43) {
-					emu->apu.nr43 = data;
-					u8 clock_shift = ((data & 0xF0) >> 4);
-					bool width = data & 0x8;
-					u8 divider = data & 0x7;
-					emu->apu.lfsr_clock_shift = clock_shift;
-					emu->apu.lfsr_width = width;
-					emu->apu.lfsr_clock_divider = divider;
-					u8 div_value;
-					switch (emu->apu.lfsr_clock_divider) {
-					case 0: div_value = 8; break;
-					case 1: div_value = 16; break;
-					case 2: div_value = 32; break;
-					case 3: div_value = 48; break;
-					case 4: div_value = 64; break;
-					case 5: div_value = 80; break;
-					case 6: div_value = 96; break;
-					case 7: div_value = 112; break;
-					default: div_value = 8;
-					}
-					emu->apu.channel[3].frequency = (divider > 0 ? (divider << 4) : 8) << clock_shift;
-					return;
-				}
-				if (address == NR44) {
-					emu->apu.nr44 = data;
-					emu->apu.channel[3].length_enabled = data & 0b01000000;
-					if (data & 0b10000000) {
-						emu->apu.lfsr = 0xFFFF;
-						trigger_channel(&emu->apu.channel[3]);
-					}
-					return;
-				}
-			}
-			mem->memory[address] = data;
-			return;
-		}
-		else if (address >= 0xFF80 && address <= 0xFFFE) {
-			// hram
-			mem->memory[address] = data;
-			return;
-		}
-		else if (address == 0xFFFF) {
-			mem->memory[address] = data;
-			return;
-		}
-		break;
+// Recomputes cpu.pending_interrupts. Anything that changes IF or IE without going through write8 or
+// request_interrupt has to call this.
+void update_interrupts(Emulator* emu) {
+	if (emu->cpu.joypad_held) {
+		emu->mmu.memory[IF] |= JOYPAD_INTERRUPT;
 	}
+	emu->cpu.pending_interrupts = emu->mmu.memory[IF] & emu->mmu.memory[IE];
+}
+
+// Rechecks the buttons against the P1 selection, after either changes.
+void update_joypad(Emulator* emu) {
+	u8 j_ret = joypad_return(emu->controller, emu->mmu.memory[0xFF00]);
+	emu->cpu.joypad_held = ~j_ret & 0b00001111;
+	update_interrupts(emu);
 }
 
 int load_bootrom(Mmu* mem, const char* path) {
@@ -364,90 +255,92 @@ int load_bootrom(Mmu* mem, const char* path) {
 	if (fp == NULL) {
 		return -1;
 	}
-	fread(mem->bios, sizeof(u8), 0x100, fp);
+	u8 bios[0x100];
+	size_t read = fread(bios, sizeof(u8), 0x100, fp);
+	fclose(fp);
+	if (read != 0x100) { // keep whatever boot ROM was there rather than half of this one
+		return -1;
+	}
+	memcpy(mem->bios, bios, 0x100);
+	++mem->map_generation;
+	map_cartridge(mem);
 	return 0;
 }
 
-int load_rom(Mmu* mem, const char* path) { // I believe this is working
-	FILE* fp;
-	fp = fopen(path, "rb");
-	if (fp == NULL) {
-		return -1;
+static int ram_size_from_header(u8 ram_size_val) {
+	switch (ram_size_val) {
+	case 2:
+		return 0x2000;
+	case 3:
+		return 0x2000 * 4;
+	case 4:
+		return 0x2000 * 16;
+	case 5:
+		return 0x2000 * 8;
+	default:
+		return 0;
 	}
-	memset(mem->memory, 0, sizeof(mem->memory));
+}
 
-	u8 cart_type_val;
-	if (fseek(fp, 0x147, SEEK_SET) != 0) {
-		fclose(fp);
+// Frees the ROM and cartridge RAM. The debugger and save file are the callers' business.
+static void release_cartridge(Cartridge* cart) {
+	aot_unload(cart);
+	release_stored_rom(cart->stored_rom);
+	cart->rom = NULL;
+	cart->stored_rom = NULL;
+	free(cart->ram);
+	cart->ram = NULL;
+}
+
+// Loads a ROM into the whole emulator, optionally prefaulting it (see mmu/rom_image.h). Takes the Emulator
+// rather than the Mmu so the CPU's cached interrupt and joypad state is reset along with the memory. The
+// image is shared with any other emulator that has the same ROM loaded (see mmu/rom_store.h). Replaces any
+// ROM already loaded; on failure that one stays.
+int load_emu_rom(Emulator* emu, const char* path, bool prefault) {
+	Mmu* mem = &emu->mmu;
+	RomImage image;
+	if (open_rom_image(&image, path, prefault) != 0) {
 		return -1;
 	}
-	fread(&cart_type_val, sizeof(u8), 1, fp);
-	rewind(fp);
-
-	mem->cartridge.type = cart_type_val;
-
-	u8 rom_size_val; // read rom file into mem->cartridge.rom
-	if (fseek(fp, 0x148, SEEK_SET) != 0) {
-		fclose(fp);
+	if (image.size <= RAM_SIZE || image.data[ROM_SIZE] > 8) {
+		release_rom_image(&image);
 		return -1;
 	}
-	if (fread(&rom_size_val, sizeof(u8), 1, fp) != 1) {
-		fclose(fp);
+	int rom_size = (BANKSIZE * 2) * (1 << image.data[ROM_SIZE]);
+	int ram_size = ram_size_from_header(image.data[RAM_SIZE]);
+	u8* ram = NULL;
+	if (pad_rom_image(&image, rom_size) != 0
+		|| (ram_size && (ram = (u8*)calloc(ram_size, sizeof(u8))) == NULL)) {
+		release_rom_image(&image);
 		return -1;
 	}
-	rewind(fp);
+	StoredRom* rom = share_rom_image(&image, rom_size);
+	if (rom == NULL) {
+		free(ram);
+		return -1;
+	}
+
+	// the old ROM goes only now, so reloading the same one keeps the stored image
+	release_cartridge(&mem->cartridge);
+	memset(mem->memory, 0, 0x10000);
 
-	int rom_size = (BANKSIZE * 2) * (1 << rom_size_val);
+	mem->cartridge.type = rom->image.data[CARTRIDGE_TYPE];
+	mem->cartridge.rom = rom->image.data;
+	mem->cartridge.stored_rom = rom;
 	mem->cartridge.rom_size = rom_size;
 	mem->cartridge.num_rom_banks = rom_size / BANKSIZE;
-	mem->cartridge.rom = (u8*)malloc(sizeof(u8) * rom_size);
-	if (mem->cartridge.rom == NULL) {
-		return -1;
-	}
-	fread(mem->cartridge.rom, sizeof(u8), rom_size, fp);
-	rewind(fp);
-
-	u8 ram_size_val;
-	fseek(fp, 0x149, SEEK_SET);
-	fread(&ram_size_val, sizeof(u8), 1, fp);
-	rewind(fp);
-	int actual_ram_size;
-	switch (ram_size_val) {
-	case 0:
-		actual_ram_size = 0;
-		break;
-	case 1:
-		actual_ram_size = 0;
-		break;
-	case 2:
-		actual_ram_size = 0x2000;
-		break;
-	case 3:
-		actual_ram_size = 0x2000 * 4;
-		break;
-	case 4:
-		actual_ram_size = 0x2000 * 16;
-		break;
-	case 5:
-		actual_ram_size = 0x2000 * 8;
-		break;
-	default:
-		actual_ram_size = 0;
-		break;
-	}
-	mem->cartridge.ram_size = actual_ram_size;
-	if (actual_ram_size) {
-		mem->cartridge.ram = (u8*)malloc(sizeof(u8) * actual_ram_size);
-		if (mem->cartridge.ram == NULL) {
-			return -1;
-		}
-		memset(mem->cartridge.ram, 0, actual_ram_size);
-	}
-	fclose(fp);
+	mem->cartridge.ram = ram;
+	mem->cartridge.ram_size = ram_size;
+	cart_set_mapper(&mem->cartridge);
+	++mem->map_generation;
+	++mem->rom_loads;
+	map_cartridge(mem);
 
 	if (mem->cartridge.type == MBC1_RAM_BATTERY) {
 		load_save(mem, path);
 	}
+	aot_load(&mem->cartridge);
+	update_joypad(emu); // IF, IE and P1 were just cleared
 
 	return 0;
 }
@@ -459,7 +352,9 @@ int load_save(Mmu* mem, const char* path) {
 	if (fp == NULL) {
 		return -1;
 	}
-	if (fread(mem->cartridge.ram, sizeof(u8), mem->cartridge.ram_size, fp) == mem->cartridge.ram_size) {
+	size_t read = fread(mem->cartridge.ram, sizeof(u8), mem->cartridge.ram_size, fp);
+	fclose(fp);
+	if (read == (size_t)mem->cartridge.ram_size) {
 		return 0;
 	}
 	else {
@@ -486,8 +381,7 @@ void destroy_mmu(Mmu* mem) {
 			}
 		}
 	}
-	if (mem->cartridge.rom) free(mem->cartridge.rom);
-	if (mem->cartridge.ram) free(mem->cartridge.ram);
+	release_cartridge(&mem->cartridge);
 	if (mem->memory) free(mem->memory);
 	if (mem->bios) free(mem->bios);
 }
\ No newline at end of file
@@ -3,12 +3,19 @@
 #include "../global_definitions.h"
 
 void init_mmu(Mmu* mem);
+void map_pages(Mmu* mem);
+void leave_bios(Emulator* emu);
+void map_vram(Emulator* emu);
+void map_wram(Emulator* emu);
 int load_bootrom(Mmu* mem, const char* path);
-int load_rom(Mmu* mem, const char* path);
+int load_emu_rom(Emulator* emu, const char* path, bool prefault);
 u8 read8(Emulator* emu, u16 address);
 void write8(Emulator* emu, u16 address, u8 data);
 u16 read16(Emulator* emu, u16 address);
 void write16(Emulator* emu, u16 address, u16 data);
+void request_interrupt(Emulator* emu, u8 flag);
+void update_interrupts(Emulator* emu);
+void update_joypad(Emulator* emu);
 int load_save(Mmu* mem, const char* path);
 
 void destroy_mmu(Mmu* mmu);
\ No newline at end of file
@@ -0,0 +1,138 @@
+// for mmap's MAP_POPULATE and madvise under a strict -std=c11
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "rom_image.h"
+
+#ifdef ROM_MMAP_AVAILABLE
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static int read_rom_image(RomImage* image, const char* path) {
+	FILE* fp = fopen(path, "rb");
+	if (fp == NULL) {
+		return -1;
+	}
+	if (fseek(fp, 0, SEEK_END) != 0) {
+		fclose(fp);
+		return -1;
+	}
+	long size = ftell(fp);
+	rewind(fp);
+	if (size <= 0) {
+		fclose(fp);
+		return -1;
+	}
+	image->data = (u8*)malloc(size);
+	if (image->data == NULL) {
+		fclose(fp);
+		return -1;
+	}
+	if (fread(image->data, sizeof(u8), size, fp) != (size_t)size) {
+		free(image->data);
+		image->data = NULL;
+		fclose(fp);
+		return -1;
+	}
+	fclose(fp);
+	image->size = size;
+	image->mapping = 0;
+	return 0;
+}
+
+#ifdef ROM_MMAP_AVAILABLE
+static RomFileId file_id(const struct stat* st) {
+	return (RomFileId) { true, (unsigned long long)st->st_dev, (unsigned long long)st->st_ino,
+		(long long)st->st_size, (long long)st->st_mtime };
+}
+#endif
+
+// Loads the file at path, mapped where possible, and notes which file it was. Returns -1, leaving image
+// empty, if it can't be read.
+int open_rom_image(RomImage* image, const char* path, bool prefault) {
+	image->data = NULL;
+	image->size = 0;
+	image->mapping = 0;
+	image->file.known = false;
+#ifdef ROM_MMAP_AVAILABLE
+	int fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		return -1;
+	}
+	struct stat st;
+	if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+		close(fd);
+		return -1;
+	}
+	int flags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+	if (prefault) {
+		flags |= MAP_POPULATE;
+	}
+#endif
+	void* data = mmap(NULL, st.st_size, PROT_READ, flags, fd, 0);
+	close(fd); // the mapping keeps the file open
+	if (data == MAP_FAILED) {
+		if (read_rom_image(image, path) != 0) {
+			return -1;
+		}
+		image->file = file_id(&st);
+		return 0;
+	}
+#if !defined(MAP_POPULATE) && defined(MADV_WILLNEED)
+	if (prefault) {
+		madvise(data, st.st_size, MADV_WILLNEED);
+	}
+#endif
+	image->data = (u8*)data;
+	image->size = st.st_size;
+	image->mapping = st.st_size;
+	image->file = file_id(&st);
+	return 0;
+#else
+	(void)prefault;
+	return read_rom_image(image, path);
+#endif
+}
+
+// Makes sure the image has at least size bytes, copying it into a zero padded buffer if it's short.
+int pad_rom_image(RomImage* image, size_t size) {
+	if (image->size >= size) {
+		return 0;
+	}
+	u8* data = (u8*)calloc(size, sizeof(u8));
+	if (data == NULL) {
+		return -1;
+	}
+	memcpy(data, image->data, image->size);
+	RomFileId file = image->file;
+	release_rom_image(image);
+	image->data = data;
+	image->file = file; // still the same file, padded the same way every time
+	image->size = size;
+	return 0;
+}
+
+void release_rom_image(RomImage* image) {
+	if (image->data == NULL) {
+		return;
+	}
+#ifdef ROM_MMAP_AVAILABLE
+	if (image->mapping) {
+		munmap(image->data, image->mapping);
+	}
+	else
+#endif
+	{
+		free(image->data);
+	}
+	image->data = NULL;
+	image->size = 0;
+	image->mapping = 0;
+}
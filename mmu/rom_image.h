@@ -0,0 +1,19 @@
+#pragma once
+#include "../global_definitions.h"
+
+// Whole ROM files in memory for load_emu_rom. Where mmap is available the file is mapped read-only and
+// MAP_PRIVATE, so loading costs no copy and the page cache is shared between processes running the same
+// ROM; cartridge.rom then points straight into the mapping and the header is parsed from it. Elsewhere, or
+// for a file shorter than its header says (a mapping can't be read past the end of the file), the image is
+// a malloc'd copy instead.
+//
+// Prefaulting reads the whole mapping in up front (MAP_POPULATE on Linux, MADV_WILLNEED elsewhere) so the
+// first bank switches don't page fault.
+
+#if defined(__linux__) || defined(__APPLE__)
+#define ROM_MMAP_AVAILABLE
+#endif
+
+int open_rom_image(RomImage* image, const char* path, bool prefault);
+int pad_rom_image(RomImage* image, size_t size);
+void release_rom_image(RomImage* image);
@@ -0,0 +1,108 @@
+#include <stdlib.h>
+#include <string.h>
+#include "rom_store.h"
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <pthread.h>
+static pthread_mutex_t store_lock = PTHREAD_MUTEX_INITIALIZER;
+#define lock_store() pthread_mutex_lock(&store_lock)
+#define unlock_store() pthread_mutex_unlock(&store_lock)
+#else
+#define lock_store()
+#define unlock_store()
+#endif
+
+static StoredRom* stored_roms = NULL;
+
+// Takes over image, whose first size bytes are the ROM. Returns the stored copy of it with a reference
+// added for the caller, image itself if it's the first, or NULL if it couldn't be stored; either way image
+// is left empty.
+static bool same_file(const RomFileId* a, const RomFileId* b) {
+	return a->known && b->known && a->device == b->device && a->inode == b->inode && a->size == b->size
+		&& a->mtime == b->mtime;
+}
+
+StoredRom* share_rom_image(RomImage* image, int size) {
+	lock_store();
+	StoredRom* found = NULL;
+	for (StoredRom* rom = stored_roms; rom != NULL; rom = rom->next) {
+		if (rom->size == size && same_file(&rom->image.file, &image->file)) {
+			found = rom;
+			break;
+		}
+	}
+	// A file the store hasn't seen can still hold a stored ROM (a copy, or the same file rewritten).
+	for (StoredRom* rom = stored_roms; found == NULL && rom != NULL; rom = rom->next) {
+		if (rom->size == size && memcmp(rom->image.data, image->data, size) == 0) {
+			found = rom;
+		}
+	}
+	if (found != NULL) {
+		++found->references;
+		unlock_store();
+		release_rom_image(image);
+		return found;
+	}
+	StoredRom* rom = (StoredRom*)malloc(sizeof(StoredRom));
+	if (rom != NULL) {
+		rom->hashed = false;
+		rom->hash = 0;
+		rom->size = size;
+		rom->image = *image;
+		rom->references = 1;
+		rom->next = stored_roms;
+		stored_roms = rom;
+		image->data = NULL;
+	}
+	unlock_store();
+	release_rom_image(image);
+	return rom;
+}
+
+// Drops a reference from share_rom_image, releasing the image with the last one.
+void release_stored_rom(StoredRom* rom) {
+	if (rom == NULL) {
+		return;
+	}
+	lock_store();
+	if (--rom->references > 0) {
+		unlock_store();
+		return;
+	}
+	for (StoredRom** link = &stored_roms; *link != NULL; link = &(*link)->next) {
+		if (*link == rom) {
+			*link = rom->next;
+			break;
+		}
+	}
+	unlock_store();
+	release_rom_image(&rom->image);
+	free(rom);
+}
+
+// The rom_hash of a stored ROM, worked out the first time it's asked for.
+unsigned long long stored_rom_hash(StoredRom* rom) {
+	lock_store();
+	bool hashed = rom->hashed;
+	unsigned long long hash = rom->hash;
+	unlock_store();
+	if (!hashed) {
+		hash = rom_hash(rom->image.data, rom->size); // outside the lock, it reads the whole ROM
+		lock_store();
+		rom->hash = hash;
+		rom->hashed = true;
+		unlock_store();
+	}
+	return hash;
+}
+
+// Distinct images currently held, for frontends keeping an eye on memory.
+int stored_rom_count(void) {
+	int count = 0;
+	lock_store();
+	for (StoredRom* rom = stored_roms; rom != NULL; rom = rom->next) {
+		++count;
+	}
+	unlock_store();
+	return count;
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include "../global_definitions.h"
+#include "rom_image.h"
+
+// Process-wide store of loaded ROM images, so any number of emulators running the same cartridge share
+// one read-only copy. load_emu_rom hands each new image to share_rom_image, which keeps it or drops it in
+// favour of the copy already stored. Images are looked up by the file they came from (device, inode, size
+// and mtime), so reloading a stored ROM doesn't touch its pages; only an image from a file the store hasn't
+// seen is compared byte for byte with the stored ones of its size. The rom_hash an AOT module is named by
+// is worked out on first use by stored_rom_hash. Each Cartridge holds one reference, given back by
+// destroy_mmu or the next load_emu_rom; the image is released with the last one. Everything per instance
+// (cartridge RAM, bank registers) stays in the Cartridge.
+//
+// The store is locked on Linux and macOS, so emulators can be created and destroyed on different threads
+// there.
+
+struct _stored_rom {
+	bool hashed; // hash is only filled in by stored_rom_hash
+	unsigned long long hash;
+	int size; // bytes compared and shared, the ROM size from the header
+	RomImage image;
+	int references;
+	StoredRom* next;
+};
+
+// FNV-1a over the whole ROM image, the name of an AOT module (see cpu/aot.h), so tools/aot_compile.c uses
+// it too.
+static inline unsigned long long rom_hash(const u8* rom, int size) {
+	unsigned long long hash = 0xCBF29CE484222325ULL;
+	for (int i = 0; i < size; ++i) {
+		hash ^= rom[i];
+		hash *= 0x100000001B3ULL;
+	}
+	return hash;
+}
+
+StoredRom* share_rom_image(RomImage* image, int size);
+void release_stored_rom(StoredRom* rom);
+unsigned long long stored_rom_hash(StoredRom* rom);
+int stored_rom_count(void);
@@ -1,5 +1,7 @@
 #include <stdlib.h>
+#include <limits.h>
 #include "timer.h"
+#include "../mmu/mmu.h"
 
 Timer* create_timer() {
 	Timer* ret = (Timer*)malloc(sizeof(Timer));
@@ -15,6 +17,7 @@ void init_timer(Timer* timer) {
 }
 
 static u16 freq_divider[] = { 1024, 16, 64, 256 };
+static int tima_bits[] = { 9, 3, 5, 7 }; // TIMA counts falling edges of this bit of the internal clock
 
 void timer_step(Emulator* emu, int t_cycles) {
 
@@ -31,22 +34,7 @@ void timer_step(Emulator* emu, int t_cycles) {
 	u8 tac_mode = tac & 3;
 
 	bool should_inc_tima = false;
-	int bit_check = 0;
-
-	switch (tac_mode) {
-	case 0:
-		bit_check = 9;
-		break;
-	case 1:
-		bit_check = 3;
-		break;
-	case 2:
-		bit_check = 5;
-		break;
-	case 3:
-		bit_check = 7;
-		break;
-	}
+	int bit_check = tima_bits[tac_mode];
 
 	bool and_result = tac_enable && (emu->timer.clock & (1 << bit_check));
 
@@ -58,7 +46,7 @@ void timer_step(Emulator* emu, int t_cycles) {
 
 	if (tac_enable && should_inc_tima) {
 		if (emu->mmu.memory[TIMA] == 255) {
-			emu->mmu.memory[IF] |= TIMER_INTERRUPT;
+			request_interrupt(emu, TIMER_INTERRUPT);
 			emu->mmu.memory[TIMA] = emu->mmu.memory[TMA];
 		}
 		else {
@@ -68,3 +56,38 @@ void timer_step(Emulator* emu, int t_cycles) {
 
 
 }
+
+// Cycles from now until the TIMA overflow that would raise the timer interrupt, or INT_MAX if it's off. 0 when
+// old_and doesn't match the clock yet (TAC was just written), since timer_skip can't account for that edge.
+int timer_next_event(Emulator* emu) {
+	u8 tac = emu->mmu.memory[TAC];
+	bool tac_enable = tac & (1 << 2);
+	int bit = tima_bits[tac & 3];
+	u32 clock = emu->timer.clock;
+
+	if (emu->timer.old_and != (tac_enable && (clock & (1 << bit)))) {
+		return 0;
+	}
+	if (!tac_enable) {
+		return INT_MAX;
+	}
+	u32 period = 1 << (bit + 1);
+	u32 edges = 256 - emu->mmu.memory[TIMA];
+	return (int)(((clock / period) + edges) * period - clock);
+}
+
+// Same as timer_step called every 4 cycles for t_cycles, as long as that stops short of timer_next_event.
+void timer_skip(Emulator* emu, int t_cycles) {
+	u32 old_clock = emu->timer.clock;
+	u32 new_clock = old_clock + t_cycles;
+	emu->mmu.memory[DIV] += (new_clock >> 8) - (old_clock >> 8);
+	emu->timer.clock = (u16)new_clock;
+
+	u8 tac = emu->mmu.memory[TAC];
+	if (!(tac & (1 << 2))) {
+		return;
+	}
+	int bit = tima_bits[tac & 3];
+	emu->mmu.memory[TIMA] += (new_clock >> (bit + 1)) - (old_clock >> (bit + 1));
+	emu->timer.old_and = new_clock & (1 << bit);
+}
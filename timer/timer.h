@@ -1,4 +1,6 @@
 #include "../global_definitions.h"
 
 void init_timer(Timer* timer);
-void timer_step(Emulator* emu, int m_cycles);
\ No newline at end of file
+void timer_step(Emulator* emu, int m_cycles);
+int timer_next_event(Emulator* emu);
+void timer_skip(Emulator* emu, int t_cycles);
@@ -0,0 +1,149 @@
+// Checks the table-driven ALU (cpu/alu_tables.h) against the branching one for every arithmetic and CB
+// shift/rotate opcode, over all operands and incoming flags, then times both on a random mix of those
+// ops. From the repository root:
+//
+//   cc -O2 -o alu_bench tools/alu_bench.c cpu/alu_tables.c cpu/operations.c -lpthread
+//   ./alu_bench [iterations]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../cpu/alu.h"
+
+#define NUM_SAMPLES 4096
+
+typedef struct {
+	instruction_type type;
+	u8 x;
+	u8 y;
+	u8 f;
+	u8 set_mask;
+	u8 reset_mask;
+	u8 ignore_mask;
+} Sample;
+
+static void flag_masks(instruction_flags flags, u8* set, u8* reset, u8* ignore) {
+	flag_action actions[4] = { flags.zero, flags.sub, flags.halfcarry, flags.carry };
+	u8 bits[4] = { FLAG_ZERO, FLAG_SUB, FLAG_HALFCARRY, FLAG_CARRY };
+	*set = 0;
+	*reset = 0xFF;
+	*ignore = 0;
+	for (int i = 0; i < 4; ++i) {
+		if (actions[i] == SET) *set |= bits[i];
+		if (actions[i] == RESET) *reset &= ~bits[i];
+		if (actions[i] == _IGNORE) *ignore |= bits[i];
+	}
+}
+
+static bool in_tables(instruction_type type) {
+	switch (type) {
+	case ADD:
+	case ADC:
+	case INC:
+	case SUB:
+	case SBC:
+	case CP:
+	case DEC:
+		return true;
+	default:
+		return alu_shift_index(type) >= 0;
+	}
+}
+
+// 16-bit ADDs share the ADD type but go through alu16
+static bool is_alu8(const Operation* op) {
+	return in_tables(op->type) && op->dest_addr_mode != REGISTER16 && op->source_addr_mode != REGISTER16 && op->source_addr_mode != MEM_READ16;
+}
+
+static int check(const Operation* table, const char* const* mnemonics, const char* name) {
+	int mismatches = 0;
+	Cpu cpu;
+	memset(&cpu, 0, sizeof(Cpu));
+	for (int i = 0; i < 0x100; ++i) {
+		const Operation* op = &table[i];
+		if (!is_alu8(op)) {
+			continue;
+		}
+		u8 set, reset, ignore;
+		flag_masks(op->flag_actions, &set, &reset, &ignore);
+		for (int f = 0; f < 0x100; f += 0x10) {
+			cpu.registers.f = f;
+			for (int x = 0; x < 0x100; ++x) {
+				for (int y = 0; y < 0x100; ++y) {
+					alu_return expected = alu8_compute(&cpu, x, y, op->type, set, reset, ignore);
+					alu_return actual = alu8_lookup(&cpu, x, y, op->type, set, reset, ignore);
+					if (expected.result != actual.result || expected.flags != actual.flags) {
+						if (mismatches++ < 10) {
+							fprintf(stderr, "%s %02X (%s) x=%02X y=%02X f=%02X: expected %02X/%02X, got %02X/%02X\n", name, i, mnemonics[i], x, y, f,
+								expected.result, expected.flags, actual.result, actual.flags);
+						}
+					}
+				}
+			}
+		}
+	}
+	return mismatches;
+}
+
+static Sample samples[NUM_SAMPLES];
+
+static void make_samples() {
+	const Operation* ops[0x200];
+	int num_ops = 0;
+	for (int i = 0; i < 0x100; ++i) {
+		if (is_alu8(&operations[i])) ops[num_ops++] = &operations[i];
+		if (is_alu8(&cb_operations[i])) ops[num_ops++] = &cb_operations[i];
+	}
+	srand(1);
+	for (int i = 0; i < NUM_SAMPLES; ++i) {
+		const Operation* op = ops[rand() % num_ops];
+		Sample* sample = &samples[i];
+		sample->type = op->type;
+		sample->x = rand();
+		sample->y = rand();
+		sample->f = rand() & 0xF0;
+		flag_masks(op->flag_actions, &sample->set_mask, &sample->reset_mask, &sample->ignore_mask);
+	}
+}
+
+// Each op's flags feed the next one's carry-in, the way they do in a real instruction stream.
+#define BENCH(name, fn) \
+	static double name(long iterations, u32* sink) { \
+		Cpu cpu; \
+		memset(&cpu, 0, sizeof(Cpu)); \
+		u32 acc = 0; \
+		clock_t start = clock(); \
+		for (long i = 0; i < iterations; ++i) { \
+			const Sample* s = &samples[i & (NUM_SAMPLES - 1)]; \
+			alu_return ret = fn(&cpu, s->x ^ (u8)acc, s->y, s->type, s->set_mask, s->reset_mask, s->ignore_mask); \
+			cpu.registers.f = ret.flags; \
+			acc += ret.result; \
+		} \
+		*sink += acc; \
+		return (double)(clock() - start) / CLOCKS_PER_SEC; \
+	}
+
+BENCH(bench_compute, alu8_compute)
+BENCH(bench_lookup, alu8_lookup)
+
+int main(int argc, char** argv) {
+	long iterations = argc > 1 ? atol(argv[1]) : 100000000;
+
+	init_alu_tables();
+	int mismatches = check(operations, operation_mnemonics, "op") + check(cb_operations, cb_operation_mnemonics, "cb");
+	if (mismatches) {
+		fprintf(stderr, "%d mismatches\n", mismatches);
+		return 1;
+	}
+	printf("tables match alu8_compute\n");
+
+	make_samples();
+	u32 sink = 0;
+	double compute = bench_compute(iterations, &sink);
+	double lookup = bench_lookup(iterations, &sink);
+	printf("alu8_compute: %.3fs (%.2f ns/op)\n", compute, compute * 1e9 / iterations);
+	printf("alu8_lookup:  %.3fs (%.2f ns/op)\n", lookup, lookup * 1e9 / iterations);
+	printf("(%u)\n", sink);
+	return 0;
+}
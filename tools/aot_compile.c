@@ -0,0 +1,772 @@
+// Compiles the reachable code of a ROM ahead of time into C for a shared object the core picks up in
+// load_emu_rom (see cpu/aot.h). From the repository root:
+//
+//   cc -o aot_compile tools/aot_compile.c cpu/operations.c
+//   ./aot_compile game.gb > game_aot.c
+//   cc -shared -fPIC -O2 -I. game_aot.c -o aot/<hash>.so
+//   YOLAHBOY_AOT_DIR=aot ./your_frontend game.gb
+//
+// The last step takes the same flavor and ENABLE_* flags as the core: the blocks keep registers in locals and
+// go through the page tables themselves, so they are built against its Emulator layout. The module records
+// those flags (AOT_OPTIONS) and isn't loaded into a core built with other ones. The module's file name is
+// printed on stderr. Code is found by following jumps, calls and RSTs from the entry point and the interrupt
+// vectors. A jump from bank 0 into 0x4000-0x7FFF is followed in every switchable bank since the bank isn't
+// known statically; whatever the walk misses runs in the interpreter.
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../cpu/aot.h"
+#include "../cpu/block_cache.h"
+#include "../cpu/operation_definitions.h"
+#include "../mmu/rom_store.h"
+
+typedef struct {
+	u8 opcode;
+	u8 length;
+	u16 operand;
+} Instruction;
+
+typedef struct {
+	u32 key;
+	int bank;
+	u16 pc;
+	int num_ops;
+	Instruction ops[MAX_BLOCK_OPS];
+} CompiledBlock;
+
+typedef struct {
+	int bank;
+	u16 pc;
+} Target;
+
+static u8* rom;
+static int rom_size;
+static int num_banks;
+static u8* queued; // one byte per bank 0 address, then per address of each switchable bank
+
+static Target* queue;
+static int queue_len;
+static int queue_cap;
+
+static CompiledBlock* blocks;
+static int num_blocks;
+static int blocks_cap;
+
+static const char* reg8(operand_type type) {
+	switch (type) {
+	case A: return "a";
+	case B: return "b";
+	case C: return "c";
+	case D: return "d";
+	case E: return "e";
+	case H: return "h";
+	case L: return "l";
+	default: return NULL;
+	}
+}
+
+static int immediate_bytes(address_mode mode) {
+	switch (mode) {
+	case MEM_READ:
+	case MEM_READ_ADDR_OFFSET:
+		return 1;
+	case MEM_READ16:
+	case MEM_READ_ADDR:
+		return 2;
+	default:
+		return 0;
+	}
+}
+
+// Same as instruction_lengths in cpu/handlers.c.
+static int instruction_length(const Operation* op) {
+	int length = 1 + immediate_bytes(op->dest_addr_mode) + immediate_bytes(op->source_addr_mode);
+	if (op->source == SP_ADD_I8) ++length;
+	return length;
+}
+
+static u8 rom_byte(int bank, int address) {
+	int offset = address < 0x4000 ? address : bank * BANKSIZE + (address - 0x4000);
+	return offset < rom_size ? rom[offset] : 0xFF;
+}
+
+static void add_target(int bank, int address) {
+	if (address < 0 || address >= 0x8000) { // RAM and I/O are left to the interpreter
+		return;
+	}
+	if (address < 0x4000) {
+		bank = 0;
+	}
+	int index = address < 0x4000 ? address : (bank + 1) * 0x4000 + (address - 0x4000);
+	if (queued[index]) {
+		return;
+	}
+	queued[index] = 1;
+
+	if (queue_len == queue_cap) {
+		queue_cap = queue_cap ? queue_cap * 2 : 1024;
+		queue = (Target*)realloc(queue, queue_cap * sizeof(Target));
+	}
+	queue[queue_len++] = (Target){ bank, (u16)address };
+}
+
+static void add_jump_target(int from_bank, u16 from_pc, int address) {
+	if (from_pc < 0x4000 && address >= 0x4000 && address < 0x8000) {
+		for (int bank = 1; bank < num_banks; ++bank) {
+			add_target(bank, address);
+		}
+		return;
+	}
+	add_target(from_bank, address);
+}
+
+static void walk_block(int bank, u16 start) {
+	int region_end = start < 0x4000 ? 0x4000 : 0x8000;
+	CompiledBlock block = { ((u32)bank << 16) | start, bank, start, 0 };
+
+	int address = start;
+	bool falls_through = true;
+	while (block.num_ops < MAX_BLOCK_OPS) {
+		u8 opcode = rom_byte(bank, address);
+		const Operation* op = &operations[opcode];
+		int length = instruction_length(op);
+		if (address + length > region_end) {
+			falls_through = false;
+			break;
+		}
+
+		Instruction* instruction = &block.ops[block.num_ops++];
+		instruction->opcode = opcode;
+		instruction->length = length;
+		instruction->operand = 0;
+		if (length == 2) {
+			instruction->operand = rom_byte(bank, address + 1);
+		}
+		else if (length == 3) {
+			instruction->operand = rom_byte(bank, address + 1) | (rom_byte(bank, address + 2) << 8);
+		}
+		int next = address + length;
+
+		switch (op->type) {
+		case JP:
+			if (op->source_addr_mode == MEM_READ16) {
+				add_jump_target(bank, address, instruction->operand);
+			}
+			else if (op->source_addr_mode == MEM_READ) {
+				add_jump_target(bank, address, (u16)(next + (i8)instruction->operand));
+			}
+			falls_through = op->condition != CONDITION_NONE;
+			break;
+		case CALL:
+			add_jump_target(bank, address, instruction->operand);
+			break;
+		case RST:
+			add_target(0, op->dest);
+			break;
+		case RET:
+			falls_through = op->condition != CONDITION_NONE;
+			break;
+		case RETI:
+			falls_through = false;
+			break;
+		default:
+			break;
+		}
+		address = next;
+		if (ends_block(op->type)) {
+			break;
+		}
+	}
+
+	if (block.num_ops == 0) {
+		return;
+	}
+	if (falls_through && address < region_end) {
+		add_target(bank, address);
+	}
+
+	if (num_blocks == blocks_cap) {
+		blocks_cap = blocks_cap ? blocks_cap * 2 : 1024;
+		blocks = (CompiledBlock*)realloc(blocks, blocks_cap * sizeof(CompiledBlock));
+	}
+	blocks[num_blocks++] = block;
+}
+
+static int compare_blocks(const void* a, const void* b) {
+	u32 x = ((const CompiledBlock*)a)->key;
+	u32 y = ((const CompiledBlock*)b)->key;
+	return (x > y) - (x < y);
+}
+
+static char body[65536];
+static int body_len;
+static bool track_ticked; // whether the body keeps ticked, off when nothing reads it back
+
+static void out(const char* fmt, ...) {
+	va_list args;
+	va_start(args, fmt);
+	body_len += vsnprintf(body + body_len, sizeof(body) - body_len, fmt, args);
+	va_end(args);
+}
+
+// Same as flag_masks in tools/gen_handlers.c.
+static void flag_masks(instruction_flags flags, u8* set, u8* reset, u8* ignore) {
+	flag_action actions[4] = { flags.zero, flags.sub, flags.halfcarry, flags.carry };
+	u8 bits[4] = { FLAG_ZERO, FLAG_SUB, FLAG_HALFCARRY, FLAG_CARRY };
+	*set = 0;
+	*reset = 0xFF;
+	*ignore = 0;
+	for (int i = 0; i < 4; ++i) {
+		if (actions[i] == SET) *set |= bits[i];
+		if (actions[i] == RESET) *reset &= ~bits[i];
+		if (actions[i] == _IGNORE) *ignore |= bits[i];
+	}
+}
+
+// Registers a block keeps in locals, one bit each.
+static const char* local_names[] = { "a", "b", "c", "d", "e", "h", "l", "f" };
+#define LOCAL_F (1 << 7)
+
+static int local_bit(const char* name) {
+	for (int i = 0; i < 8; ++i) {
+		if (strcmp(local_names[i], name) == 0) {
+			return 1 << i;
+		}
+	}
+	return 0;
+}
+
+// The two halves of BC, DE or HL.
+static bool pair(operand_type type, const char** high, const char** low) {
+	switch (type) {
+	case BC: *high = "b"; *low = "c"; return true;
+	case DE: *high = "d"; *low = "e"; return true;
+	case HL: *high = "h"; *low = "l"; return true;
+	default: return false;
+	}
+}
+
+static bool is_alu(instruction_type type) {
+	switch (type) {
+	case ADD:
+	case ADC:
+	case SUB:
+	case SBC:
+	case AND:
+	case OR:
+	case XOR:
+	case CP:
+		return true;
+	default:
+		return false;
+	}
+}
+
+// The same instructions the JIT emits natively (see can_inline in cpu/jit.c); everything else calls its
+// handler.
+static bool can_inline(const Operation* op) {
+	const char* high;
+	const char* low;
+	address_mode dest_mode = op->dest_addr_mode;
+	address_mode source_mode = op->source_addr_mode;
+	switch (op->type) {
+	case NOP:
+		return true;
+	case LD:
+		if (dest_mode == REGISTER && reg8(op->dest) != NULL) {
+			return (source_mode == REGISTER && reg8(op->source) != NULL) || source_mode == MEM_READ
+				|| (source_mode == ADDRESS_R16 && pair(op->source, &high, &low)) || source_mode == MEM_READ_ADDR;
+		}
+		if ((dest_mode == ADDRESS_R16 && pair(op->dest, &high, &low)) || dest_mode == MEM_READ_ADDR) {
+			return (source_mode == REGISTER && reg8(op->source) != NULL) || source_mode == MEM_READ;
+		}
+		return dest_mode == REGISTER16 && (op->dest == SP || pair(op->dest, &high, &low)) && source_mode == MEM_READ16;
+	case INC:
+	case DEC:
+		return (dest_mode == REGISTER && reg8(op->dest) != NULL)
+			|| (dest_mode == ADDRESS_R16 && op->dest == HL)
+			|| (dest_mode == REGISTER16 && (op->dest == SP || pair(op->dest, &high, &low)));
+	case JP:
+		return source_mode == MEM_READ || source_mode == MEM_READ16;
+	default:
+		return is_alu(op->type) && dest_mode == REGISTER && op->dest == A
+			&& ((source_mode == REGISTER && reg8(op->source) != NULL) || source_mode == MEM_READ
+				|| (source_mode == ADDRESS_R16 && op->source == HL));
+	}
+}
+
+// Locals an inlined instruction touches, F included when it reads or writes the flags.
+static int locals_used(const Operation* op) {
+	const char* high;
+	const char* low;
+	int used = 0;
+	if (op->dest_addr_mode == REGISTER && reg8(op->dest) != NULL) {
+		used |= local_bit(reg8(op->dest));
+	}
+	if (op->source_addr_mode == REGISTER && reg8(op->source) != NULL) {
+		used |= local_bit(reg8(op->source));
+	}
+	if ((op->dest_addr_mode == ADDRESS_R16 || op->dest_addr_mode == REGISTER16) && pair(op->dest, &high, &low)) {
+		used |= local_bit(high) | local_bit(low);
+	}
+	if (op->source_addr_mode == ADDRESS_R16 && pair(op->source, &high, &low)) {
+		used |= local_bit(high) | local_bit(low);
+	}
+	if (is_alu(op->type) || ((op->type == INC || op->type == DEC) && op->dest_addr_mode != REGISTER16)
+		|| op->condition != CONDITION_NONE) {
+		used |= LOCAL_F;
+	}
+	return used;
+}
+
+// The most an instruction can take, taken branches and CB ops included.
+static int max_cycles(const Instruction* instruction) {
+	const Operation* op = &operations[instruction->opcode];
+	if (op->type == CB) {
+		return op->t_cycles + cb_operations[(u8)instruction->operand].t_cycles;
+	}
+	switch (op->secondary) {
+	case ADD_T_4: return op->t_cycles + 4;
+	case ADD_T_12: return op->t_cycles + 12;
+	default: return op->t_cycles;
+	}
+}
+
+// Where emit_block stands: locals changed since they were last stored, whether f has been loaded, and the
+// first instruction not yet ticked (-1 once that's only known at run time, in ticked).
+typedef struct {
+	int dirty;
+	bool f_loaded;
+	int ticked;
+} BlockState;
+
+static const char* use_local(BlockState* state, const char* name) {
+	if (strcmp(name, "f") == 0 && !state->f_loaded) {
+		out("\tif (emu->cpu.lazy_flags.pending) {\n\t\thost.sync_flags(&emu->cpu);\n\t}\n");
+		out("\tf = r->f;\n");
+		state->f_loaded = true;
+	}
+	return name;
+}
+
+static void store_locals(const BlockState* state, const char* indent) {
+	for (int i = 0; i < 8; ++i) {
+		if (state->dirty & (1 << i)) {
+			out("%sr->%s = %s;\n", indent, local_names[i], local_names[i]);
+		}
+	}
+}
+
+static void emit_ticks(BlockState* state, const char* indent, const char* table, int index) {
+	if (state->ticked == index) {
+		return;
+	}
+	out("%shost.ticks(emu, %s + ticked, %d - ticked);\n", indent, table, index);
+}
+
+// v = byte at address
+static void emit_read(BlockState* state, const char* address, int index, u16 next_pc) {
+	out("\taddress = %s;\n", address);
+	out("\tpage = emu->mmu.read_pages[address >> 8];\n");
+	out("\tif (page != NULL) {\n\t\tv = page[address & 0xFF];\n\t}\n");
+	out("\telse {\n");
+	out("\t\tr->pc = 0x%04X;\n", next_pc);
+	emit_ticks(state, "\t\t", "cycles", index);
+	if (track_ticked) {
+		out("\t\tticked = %d;\n", index);
+	}
+	out("\t\tv = host.read8(emu, address);\n");
+	out("\t}\n");
+	state->ticked = -1;
+}
+
+// byte at address = value, setting hand_back if the block has to stop after this instruction
+static void emit_write(BlockState* state, const char* address, const char* value, int index, u16 next_pc) {
+	out("\taddress = %s;\n", address);
+	out("\tpage = emu->mmu.write_pages[address >> 8];\n");
+	out("\tif (page != NULL) {\n\t\tpage[address & 0xFF] = %s;\n\t}\n", value);
+	out("\telse {\n");
+	out("\t\tr->pc = 0x%04X;\n", next_pc);
+	emit_ticks(state, "\t\t", "cycles", index);
+	if (track_ticked) {
+		out("\t\tticked = %d;\n", index);
+	}
+	out("\t\thand_back = host.write8(emu, address, %s);\n", value);
+	out("\t}\n");
+	state->ticked = -1;
+}
+
+// dest = x op y, with F worked out the way alu8_compute does it and the flag masks baked in. dest is NULL
+// for CP.
+static void emit_alu(BlockState* state, const Operation* op, instruction_type type, const char* x, const char* y, const char* dest) {
+	u8 set, reset, ignore;
+	flag_masks(op->flag_actions, &set, &reset, &ignore);
+	use_local(state, "f");
+
+	char half[128];
+	const char* carry;
+	switch (type) {
+	case INC:
+	case ADD:
+		out("\tt = %s + %s;\n", x, y);
+		sprintf(half, "((%s & 0xF) + (%s & 0xF)) > 0xF", x, y);
+		carry = "t > 0xFF";
+		break;
+	case ADC:
+		out("\tt = %s + %s + (f >> 4 & 1);\n", x, y);
+		sprintf(half, "((%s & 0xF) + (%s & 0xF) + (f >> 4 & 1)) > 0xF", x, y);
+		carry = "t > 0xFF";
+		break;
+	case SUB:
+	case CP:
+	case DEC:
+		out("\tt = %s - %s;\n", x, y);
+		sprintf(half, "(%s & 0xF) > (%s & 0xF)", y, x);
+		carry = "t > 0xFF";
+		break;
+	case SBC:
+		out("\tt = %s - %s - (f >> 4 & 1);\n", x, y);
+		sprintf(half, "(%s & 0xF) > (%s & 0xF) - (f >> 4 & 1)", y, x);
+		carry = "t > 0xFF";
+		break;
+	default:
+		out("\tt = %s %s %s;\n", x, type == AND ? "&" : type == OR ? "|" : "^", y);
+		strcpy(half, "0");
+		carry = "0";
+		break;
+	}
+	out("\tf = FLAGS(0x%02X, t, %s, %s, 0x%02X, 0x%02X);\n", set, half, carry, reset, ignore);
+	state->dirty |= LOCAL_F;
+	if (dest != NULL) {
+		out("\t%s = (u8)t;\n", dest);
+		state->dirty |= local_bit(dest);
+	}
+}
+
+static void emit_step16(BlockState* state, operand_type type, bool increment) {
+	const char* high;
+	const char* low;
+	if (!pair(type, &high, &low)) {
+		out("\t%sr->sp;\n", increment ? "++" : "--");
+		return;
+	}
+	out("\tt = (u16)(%s << 8 | %s) %s 1;\n", high, low, increment ? "+" : "-");
+	out("\t%s = (u8)(t >> 8);\n\t%s = (u8)t;\n", high, low);
+	state->dirty |= local_bit(high) | local_bit(low);
+}
+
+static void emit_secondary(BlockState* state, const Operation* op) {
+	switch (op->secondary) {
+	case INC_R_1: emit_step16(state, op->dest, true); break;
+	case DEC_R_1: emit_step16(state, op->dest, false); break;
+	case INC_R_2: emit_step16(state, op->source, true); break;
+	case DEC_R_2: emit_step16(state, op->source, false); break;
+	default: break;
+	}
+}
+
+// The address of a memory operand.
+static void address_of(char* address, address_mode mode, operand_type type, u16 operand) {
+	const char* high;
+	const char* low;
+	if (mode == MEM_READ_ADDR || !pair(type, &high, &low)) {
+		sprintf(address, "0x%04X", operand);
+	}
+	else {
+		sprintf(address, "(u16)(%s << 8 | %s)", high, low);
+	}
+}
+
+// An 8-bit source operand: a local, a constant or v after a read.
+static void source_of(BlockState* state, char* source, const Operation* op, const Instruction* instruction, int index, u16 next_pc) {
+	char address[32];
+	switch (op->source_addr_mode) {
+	case REGISTER:
+		strcpy(source, reg8(op->source));
+		break;
+	case MEM_READ:
+		sprintf(source, "0x%02X", (u8)instruction->operand);
+		break;
+	default:
+		address_of(address, op->source_addr_mode, op->source, instruction->operand);
+		emit_read(state, address, index, next_pc);
+		strcpy(source, "v");
+		break;
+	}
+}
+
+// Everything but JR/JP. Returns whether the instruction may set hand_back.
+static bool emit_inline(BlockState* state, const Operation* op, const Instruction* instruction, int index, u16 next_pc) {
+	const char* high;
+	const char* low;
+	char source[32];
+	char address[32];
+	switch (op->type) {
+	case NOP:
+		return false;
+	case LD:
+		if (op->dest_addr_mode == REGISTER16) {
+			if (pair(op->dest, &high, &low)) {
+				out("\t%s = 0x%02X;\n\t%s = 0x%02X;\n", high, instruction->operand >> 8, low, instruction->operand & 0xFF);
+				state->dirty |= local_bit(high) | local_bit(low);
+			}
+			else {
+				out("\tr->sp = 0x%04X;\n", instruction->operand);
+			}
+			return false;
+		}
+		source_of(state, source, op, instruction, index, next_pc);
+		if (op->dest_addr_mode == REGISTER) {
+			out("\t%s = %s;\n", reg8(op->dest), source);
+			state->dirty |= local_bit(reg8(op->dest));
+			emit_secondary(state, op);
+			return false;
+		}
+		address_of(address, op->dest_addr_mode, op->dest, instruction->operand);
+		emit_write(state, address, source, index, next_pc);
+		emit_secondary(state, op);
+		return true;
+	case INC:
+	case DEC:
+		if (op->dest_addr_mode == REGISTER16) {
+			emit_step16(state, op->dest, op->type == INC);
+			return false;
+		}
+		if (op->dest_addr_mode == REGISTER) {
+			emit_alu(state, op, op->type, reg8(op->dest), "1", reg8(op->dest));
+			return false;
+		}
+		emit_read(state, "(u16)(h << 8 | l)", index, next_pc);
+		emit_alu(state, op, op->type, "v", "1", NULL);
+		emit_write(state, "(u16)(h << 8 | l)", "(u8)t", index, next_pc);
+		return true;
+	default:
+		source_of(state, source, op, instruction, index, next_pc);
+		emit_alu(state, op, op->type, "a", source, op->type == CP ? NULL : "a");
+		return false;
+	}
+}
+
+static const char* condition_of(condition cond) {
+	switch (cond) {
+	case CONDITION_Z: return "f & FLAG_ZERO";
+	case CONDITION_NZ: return "!(f & FLAG_ZERO)";
+	case CONDITION_C: return "f & FLAG_CARRY";
+	case CONDITION_NC: return "!(f & FLAG_CARRY)";
+	default: return NULL;
+	}
+}
+
+// The body of a block into body[], with ticked kept up to date after each handler call and each access that
+// missed the page tables while track_ticked is set.
+static void emit_body(const CompiledBlock* block, const int* rest, int used) {
+	int n = block->num_ops;
+	body_len = 0;
+	body[0] = '\0';
+	BlockState state = { 0, false, 0 };
+	u16 pc = block->pc;
+	for (int i = 0; i < n; ++i) {
+		const Instruction* instruction = &block->ops[i];
+		const Operation* op = &operations[instruction->opcode];
+		u16 next_pc = pc + instruction->length;
+		const char* mnemonic = operation_mnemonics[instruction->opcode] ? operation_mnemonics[instruction->opcode] : "unimplemented";
+		bool last = i + 1 == n;
+
+		out("\t// %04X: %s\n", pc, mnemonic);
+		if (pc == 0x100) {
+			out("\thost.leave_bios(emu);\n");
+		}
+
+		if (!can_inline(op)) {
+			out("\tr->pc = 0x%04X;\n", next_pc);
+			emit_ticks(&state, "\t", "cycles", i);
+			store_locals(&state, "\t");
+			if (last) {
+				out("\thost.tick(emu, host.handlers[0x%02X](emu, 0x%04X), 0x%04X);\n", instruction->opcode, instruction->operand, next_pc);
+				out("\treturn %d;\n", n);
+				break;
+			}
+			out("\tif (host.tick(emu, host.handlers[0x%02X](emu, 0x%04X), 0x%04X) || host.budget(emu) <= %d) {\n", instruction->opcode, instruction->operand, next_pc, rest[i + 1]);
+			out("\t\treturn %d;\n\t}\n", i + 1);
+			if (track_ticked) {
+				out("\tticked = %d;\n", i + 1);
+			}
+			for (int j = 0; j < 7; ++j) {
+				if (used & (1 << j)) {
+					out("\t%s = r->%s;\n", local_names[j], local_names[j]);
+				}
+			}
+			state = (BlockState) { 0, false, i + 1 };
+			pc = next_pc;
+			continue;
+		}
+
+		if (op->type == JP) { // always last
+			u16 target = op->source_addr_mode == MEM_READ ? (u16)(next_pc + (i8)instruction->operand) : instruction->operand;
+			const char* cond = condition_of(op->condition);
+			if (cond != NULL) {
+				use_local(&state, "f");
+			}
+			store_locals(&state, "\t");
+			if (cond != NULL) {
+				out("\tif (%s) {\n", cond);
+				out("\t\tr->pc = 0x%04X;\n", target);
+				emit_ticks(&state, "\t\t", "taken", n);
+				out("\t\treturn %d;\n\t}\n", n);
+				out("\tr->pc = 0x%04X;\n", next_pc);
+				emit_ticks(&state, "\t", "cycles", n);
+			}
+			else {
+				out("\tr->pc = 0x%04X;\n", target);
+				emit_ticks(&state, "\t", "taken", n);
+			}
+			out("\treturn %d;\n", n);
+			break;
+		}
+
+		if (emit_inline(&state, op, instruction, i, next_pc)) {
+			out("\tif (hand_back) {\n");
+			out("\t\tr->pc = 0x%04X;\n", next_pc);
+			store_locals(&state, "\t\t");
+			out("\t\thost.tick(emu, (Cycles) { %d, %d }, 0x%04X);\n", op->m_cycles, op->t_cycles, next_pc);
+			out("\t\treturn %d;\n\t}\n", i + 1);
+		}
+		if (last) {
+			out("\tr->pc = 0x%04X;\n", next_pc);
+			store_locals(&state, "\t");
+			emit_ticks(&state, "\t", "cycles", n);
+			out("\treturn %d;\n", n);
+		}
+		pc = next_pc;
+	}
+}
+
+// One function per block, run under native_budget the way the JIT runs its blocks (see compile_block in
+// cpu/jit.c): registers are kept in locals, stored back before a handler call or a return, and the cycles
+// of the inlined instructions go to host.ticks at the end or before an access that misses the page tables.
+static void emit_block(const CompiledBlock* block) {
+	int n = block->num_ops;
+	int rest[MAX_BLOCK_OPS + 1]; // at most from each instruction to the end
+	int used = 0;
+	rest[n] = 0;
+	for (int i = n - 1; i >= 0; --i) {
+		rest[i] = rest[i + 1] + max_cycles(&block->ops[i]);
+		const Operation* op = &operations[block->ops[i].opcode];
+		if (can_inline(op)) {
+			used |= locals_used(op);
+		}
+	}
+	track_ticked = true;
+	emit_body(block, rest, used);
+	if (strstr(body, "- ticked") == NULL) { // nothing reads it back, emit again without keeping it
+		track_ticked = false;
+		emit_body(block, rest, used);
+	}
+
+	printf("static int b_%04X_%04X(Emulator* emu, int budget) {\n", block->bank, block->pc);
+	if (strstr(body, "cycles + ")) {
+		printf("\tstatic const u8 cycles[] = {");
+		for (int i = 0; i < n; ++i) {
+			printf("%s %d", i ? "," : "", operations[block->ops[i].opcode].t_cycles);
+		}
+		printf(" };\n");
+	}
+	if (strstr(body, "taken + ")) {
+		printf("\tstatic const u8 taken[] = {");
+		for (int i = 0; i < n; ++i) {
+			printf("%s %d", i ? "," : "", i + 1 == n ? max_cycles(&block->ops[i]) : operations[block->ops[i].opcode].t_cycles);
+		}
+		printf(" };\n");
+	}
+	printf("\tif (budget <= %d) {\n\t\treturn 0;\n\t}\n", rest[0]);
+	printf("\tRegisters* r = &emu->cpu.registers;\n");
+	for (int i = 0; i < 7; ++i) {
+		if (used & (1 << i)) {
+			printf("\tu8 %s = r->%s;\n", local_names[i], local_names[i]);
+		}
+	}
+	if (used & LOCAL_F) {
+		printf("\tu8 f = 0;\n");
+	}
+	if (strstr(body, "\tt = ")) {
+		printf("\tunsigned t;\n");
+	}
+	if (strstr(body, "page")) {
+		printf("\tu16 address;\n\tu8* page;\n");
+	}
+	if (strstr(body, "v = ")) {
+		printf("\tu8 v;\n");
+	}
+	if (strstr(body, "ticked")) {
+		printf("\tint ticked = 0;\n");
+	}
+	if (strstr(body, "hand_back")) {
+		printf("\tbool hand_back = false;\n");
+	}
+	printf("%s}\n\n", body);
+}
+
+int main(int argc, char** argv) {
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s rom.gb > out.c\n", argv[0]);
+		return 1;
+	}
+	FILE* fp = fopen(argv[1], "rb");
+	if (fp == NULL) {
+		fprintf(stderr, "could not open %s\n", argv[1]);
+		return 1;
+	}
+	u8 header[0x150];
+	if (fread(header, 1, sizeof(header), fp) != sizeof(header)) {
+		fprintf(stderr, "%s is too small to be a ROM\n", argv[1]);
+		fclose(fp);
+		return 1;
+	}
+	rewind(fp);
+
+	// sized the way load_emu_rom sizes it, so the hash matches
+	rom_size = (BANKSIZE * 2) * (1 << header[0x148]);
+	num_banks = rom_size / BANKSIZE;
+	rom = (u8*)calloc(rom_size, 1);
+	queued = (u8*)calloc((num_banks + 1) * 0x4000, 1);
+	if (rom == NULL || queued == NULL) {
+		fclose(fp);
+		return 1;
+	}
+	fread(rom, 1, rom_size, fp);
+	fclose(fp);
+
+	add_target(0, 0x100);
+	for (int vector = 0; vector <= 0x60; vector += 8) { // RSTs and interrupts
+		add_target(0, vector);
+	}
+	for (int i = 0; i < queue_len; ++i) {
+		walk_block(queue[i].bank, queue[i].pc);
+	}
+	qsort(blocks, num_blocks, sizeof(CompiledBlock), compare_blocks);
+
+	unsigned long long hash = rom_hash(rom, rom_size);
+	printf("// Generated by tools/aot_compile.c from %s. Do not edit by hand.\n\n", argv[1]);
+	printf("#include \"cpu/aot.h\"\n\n");
+	printf("static AotHost host;\n\n");
+	printf("static void init(const AotHost* h) {\n\thost = *h;\n}\n\n");
+	printf("// F as alu8_compute works it out: set, then Z, H and C from the op, then the ignored flags kept and the\n");
+	printf("// reset ones cleared.\n");
+	printf("#define FLAGS(set, result, half, carry, reset, ignore) \\\n");
+	printf("\t(u8)(((((set) | ((u8)(result) == 0 ? FLAG_ZERO : 0) | ((half) ? FLAG_HALFCARRY : 0) | ((carry) ? FLAG_CARRY : 0)) \\\n");
+	printf("\t\t& ~(ignore)) | (f & (ignore))) & (reset))\n\n");
+	for (int i = 0; i < num_blocks; ++i) {
+		emit_block(&blocks[i]);
+	}
+	printf("static const AotEntry entries[] = {\n");
+	for (int i = 0; i < num_blocks; ++i) {
+		printf("\t{ 0x%08X, b_%04X_%04X, %d },\n", blocks[i].key, blocks[i].bank, blocks[i].pc, blocks[i].num_ops);
+	}
+	printf("};\n\n");
+	printf("const AotModuleInfo aot_module = { AOT_ABI_VERSION, sizeof(Emulator), AOT_OPTIONS, 0x%016llXULL, %d, entries, init };\n", hash, num_blocks);
+
+	fprintf(stderr, "%d blocks, module name %016llx.so\n", num_blocks, hash);
+	return 0;
+}
@@ -0,0 +1,53 @@
+// Times the core on a ROM, to compare library flavors (see build_config.h). Build it once per flavor
+// against a core built the same way. From the repository root:
+//
+//   for flavor in FAST ACCURATE DEBUG; do
+//     cc -O2 -DYOLAHBOY_$flavor -o bench_$flavor tools/flavor_bench.c $(find . -name '*.c' ! -path './tools/*') -ldl -lpthread
+//   done
+//   ./bench_FAST game.gb [frames] [dispatch mode]
+//
+// The ROM runs from the end of the boot ROM with no input for the given number of frames of emulated time
+// (default 3000).
+// Without a dispatch mode the fast flavor uses DISPATCH_JIT and the others keep the core's default. Each
+// flavor runs with its default timing, TIMING_MCYCLE for the accurate one.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../yolahboy.h"
+
+int main(int argc, char** argv) {
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s rom.gb [frames] [dispatch mode]\n", argv[0]);
+		return 1;
+	}
+	int frames = argc > 2 ? atoi(argv[2]) : 3000;
+
+	static Emulator emu;
+	if (init_emulator(&emu, 44100, 1024) != 0 || load_emu_rom(&emu, argv[1], false) != 0) {
+		fprintf(stderr, "can't load %s\n", argv[1]);
+		return 1;
+	}
+	skip_bootrom(&emu);
+#ifdef YOLAHBOY_FAST
+	set_dispatch_mode(&emu, DISPATCH_JIT);
+#endif
+	if (argc > 3) {
+		set_dispatch_mode(&emu, (DispatchMode)atoi(argv[3]));
+	}
+
+	clock_t start = clock();
+	unsigned long long end = emu.clock + (unsigned long long)frames * 70224;
+	while (emu.clock < end) {
+		if (run_frame(&emu) & RUN_ERROR) {
+			fprintf(stderr, "stopped on an unimplemented instruction at PC %04X\n", emu.cpu.registers.pc);
+			return 1;
+		}
+	}
+	double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+	printf("%-8s dispatch %d%s  %d frames in %.3f s, %.1f fps, %.2fx real time\n", core_flavor(),
+		emu.cpu.dispatch_mode, emu.timing.mode == TIMING_MCYCLE ? " M-cycle" : "", frames, seconds, frames / seconds, frames / seconds / 59.7275);
+	destroy_emulator(&emu);
+	return 0;
+}
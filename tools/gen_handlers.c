@@ -0,0 +1,653 @@
+// Generates cpu/handlers.c from the operations and cb_operations tables: one straight-line handler per
+// opcode with its registers, addressing modes, flag masks and cycle counts baked in as constants, plus the
+// instruction length table the decoder uses to pull immediates out ahead of the handler, and a fused
+// handler for each of the common sequences in fusion_patterns (see block_cache.h).
+// Rerun it whenever cpu/operations.c changes. From the repository root:
+//
+//   cc -o gen_handlers tools/gen_handlers.c cpu/operations.c
+//   ./gen_handlers > cpu/handlers.c
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include "../cpu/operation_definitions.h"
+
+static char body[4096];
+static int body_len;
+
+static void out(const char* fmt, ...) {
+	va_list args;
+	va_start(args, fmt);
+	body_len += vsnprintf(body + body_len, sizeof(body) - body_len, fmt, args);
+	va_end(args);
+}
+
+static const char* type_names[] = {
+	"UNIMPLEMENTED", "NOP", "STOP", "HALT", "LD", "INC", "DEC", "ADD", "ADC", "SUB", "SBC", "CP", "AND", "OR",
+	"XOR", "CPL", "BIT", "RR", "RL", "RLA", "RRC", "RLC", "SLA", "SRA", "SRL", "SWAP", "RES", "SET_OP", "JP",
+	"JR", "RET", "RETI", "CALL", "RST", "PUSH", "POP", "CCF", "SCF", "CB", "DI", "EI", "DAA"
+};
+
+static const char* addr_mode_names[] = {
+	"ADDR_MODE_NONE", "REGISTER", "REGISTER16", "ADDRESS_R16", "ADDRESS_R8_OFFSET", "MEM_READ", "MEM_READ16",
+	"MEM_READ_ADDR", "MEM_READ_ADDR_OFFSET"
+};
+
+static const char* reg8(operand_type type) {
+	switch (type) {
+	case A: return "a";
+	case B: return "b";
+	case C: return "c";
+	case D: return "d";
+	case E: return "e";
+	case H: return "h";
+	case L: return "l";
+	default: return NULL;
+	}
+}
+
+static const char* reg16(operand_type type) {
+	switch (type) {
+	case AF: return "af";
+	case BC: return "bc";
+	case DE: return "de";
+	case HL: return "hl";
+	case SP:
+	case SP_ADD_I8: return "sp";
+	case PC: return "pc";
+	default: return NULL;
+	}
+}
+
+static void flag_masks(instruction_flags flags, u8* set, u8* reset, u8* ignore) {
+	flag_action actions[4] = { flags.zero, flags.sub, flags.halfcarry, flags.carry };
+	u8 bits[4] = { FLAG_ZERO, FLAG_SUB, FLAG_HALFCARRY, FLAG_CARRY };
+	*set = 0;
+	*reset = 0xFF;
+	*ignore = 0;
+	for (int i = 0; i < 4; ++i) {
+		if (actions[i] == SET) *set |= bits[i];
+		if (actions[i] == RESET) *reset &= ~bits[i];
+		if (actions[i] == _IGNORE) *ignore |= bits[i];
+	}
+}
+
+static void masks_arg(const Operation* op, char* buf) {
+	u8 set, reset, ignore;
+	flag_masks(op->flag_actions, &set, &reset, &ignore);
+	sprintf(buf, "0x%02X, 0x%02X, 0x%02X", set, reset, ignore);
+}
+
+static const char* condition_expr(condition cond) {
+	switch (cond) {
+	case CONDITION_Z: return "zero_flag(&emu->cpu)";
+	case CONDITION_NZ: return "!zero_flag(&emu->cpu)";
+	case CONDITION_C: return "(read_flags(&emu->cpu) & FLAG_CARRY)";
+	case CONDITION_NC: return "!(read_flags(&emu->cpu) & FLAG_CARRY)";
+	default: return NULL;
+	}
+}
+
+static int secondary_cycles(const Operation* op) {
+	switch (op->secondary) {
+	case ADD_T_4: return 4;
+	case ADD_T_12: return 12;
+	default: return 0;
+	}
+}
+
+static bool bit_mode_16(const Operation* op) {
+	return op->dest_addr_mode == REGISTER16 || op->dest_addr_mode == MEM_READ16 || op->source_addr_mode == MEM_READ16 || op->source_addr_mode == REGISTER16;
+}
+
+// get_source
+static void emit_source8(const Operation* op) {
+	switch (op->source_addr_mode) {
+	case REGISTER:
+		out("\tu8 src = r->%s;\n", reg8(op->source));
+		break;
+	case MEM_READ:
+		out("\tu8 src = (u8)operand;\n");
+		break;
+	case ADDRESS_R16:
+		out("\tu8 src = read8(emu, r->%s);\n", reg16(op->source));
+		break;
+	case ADDRESS_R8_OFFSET:
+		out("\tu8 src = read8(emu, 0xFF00 + r->%s);\n", reg8(op->source));
+		break;
+	case MEM_READ_ADDR:
+		out("\tu8 src = read8(emu, operand);\n");
+		break;
+	case MEM_READ_ADDR_OFFSET:
+		out("\tu8 src = read8(emu, 0xFF00 + (u8)operand);\n");
+		break;
+	case ADDR_MODE_NONE:
+		out("\tu8 src = 0x%02X;\n", op->source);
+		break;
+	default:
+		out("\tu8 src = 0;\n");
+	}
+}
+
+// get_dest
+static void emit_dest8(const Operation* op) {
+	switch (op->dest_addr_mode) {
+	case ADDRESS_R8_OFFSET:
+	case REGISTER:
+		out("\tu8 dst = r->%s;\n", reg8(op->dest));
+		break;
+	case ADDRESS_R16:
+		out("\tu8 dst = read8(emu, r->%s);\n", reg16(op->dest));
+		break;
+	case MEM_READ_ADDR_OFFSET:
+	case MEM_READ:
+		out("\tu8 dst = (u8)operand;\n");
+		break;
+	default:
+		out("\tu8 dst = 0;\n");
+	}
+}
+
+// write_dest
+static void emit_write_dest8(const Operation* op, const char* value) {
+	switch (op->dest_addr_mode) {
+	case REGISTER:
+		out("\tr->%s = %s;\n", reg8(op->dest), value);
+		break;
+	case ADDRESS_R16:
+		out("\twrite8(emu, r->%s, %s);\n", reg16(op->dest), value);
+		break;
+	case ADDRESS_R8_OFFSET:
+		out("\twrite8(emu, 0xFF00 + r->%s, %s);\n", reg8(op->dest), value);
+		break;
+	case MEM_READ_ADDR:
+		out("\twrite8(emu, operand, %s);\n", value);
+		break;
+	case MEM_READ_ADDR_OFFSET:
+		out("\twrite8(emu, 0xFF00 + (u8)operand, %s);\n", value);
+		break;
+	default:
+		break;
+	}
+}
+
+// Whether emit_write_dest8 writes anything; SCF and CCF only set flags.
+static bool writes_dest8(const Operation* op) {
+	switch (op->dest_addr_mode) {
+	case REGISTER:
+	case ADDRESS_R16:
+	case ADDRESS_R8_OFFSET:
+	case MEM_READ_ADDR:
+	case MEM_READ_ADDR_OFFSET:
+		return true;
+	default:
+		return false;
+	}
+}
+
+// get_source_16
+static void emit_source16(const Operation* op) {
+	char masks[32];
+	masks_arg(op, masks);
+	switch (op->source_addr_mode) {
+	case REGISTER16:
+		if (op->source == SP_ADD_I8) {
+			out("\tu16 offset = (i16)(i8)operand;\n");
+			out("\talu16_return sp_ret = alu16(&emu->cpu, r->sp, offset, ADD, MEM_READ, %s);\n", masks);
+			out("\twrite_flags(&emu->cpu, sp_ret.flags);\n");
+			out("\tu16 src = sp_ret.result;\n");
+			break;
+		}
+		out("\tu16 src = r->%s;\n", reg16(op->source));
+		break;
+	case MEM_READ16:
+		out("\tu16 src = operand;\n");
+		break;
+	case MEM_READ:
+		if (op->source == I8) {
+			out("\tu16 src = (i16)(i8)operand;\n");
+			break;
+		}
+		out("\tu16 src = 0;\n");
+		break;
+	default:
+		out("\tu16 src = 0;\n");
+	}
+}
+
+static void emit_secondary_register(const Operation* op) {
+	switch (op->secondary) {
+	case INC_R_1:
+		out("\t++r->%s;\n", reg16(op->dest));
+		break;
+	case DEC_R_1:
+		out("\t--r->%s;\n", reg16(op->dest));
+		break;
+	case INC_R_2:
+		out("\t++r->%s;\n", reg16(op->source));
+		break;
+	case DEC_R_2:
+		out("\t--r->%s;\n", reg16(op->source));
+		break;
+	default:
+		break;
+	}
+}
+
+static void emit_return(const Operation* op, int extra_t) {
+	out("\treturn (Cycles) { %d, %d };\n", op->m_cycles, op->t_cycles + extra_t);
+}
+
+static void emit_ld(const Operation* op) {
+	if (bit_mode_16(op)) {
+		emit_source16(op);
+		switch (op->dest_addr_mode) {
+		case REGISTER16:
+			out("\tr->%s = src;\n", reg16(op->dest));
+			break;
+		case MEM_READ_ADDR:
+			out("\twrite16(emu, operand, src);\n");
+			break;
+		default:
+			break;
+		}
+	}
+	else {
+		emit_source8(op);
+		emit_write_dest8(op, "src");
+	}
+	emit_secondary_register(op);
+	emit_return(op, 0);
+}
+
+static void emit_alu8(const Operation* op, bool write_back, const char* source_override) {
+	char masks[32];
+	masks_arg(op, masks);
+	if (source_override == NULL) {
+		emit_source8(op);
+	}
+	emit_dest8(op);
+	if (write_back && writes_dest8(op)) {
+		out("\tu8 result = alu8_update(&emu->cpu, dst, %s, %s, %s);\n", source_override ? source_override : "src", type_names[op->type], masks);
+		emit_write_dest8(op, "result");
+	}
+	else {
+		out("\talu8_update(&emu->cpu, dst, %s, %s, %s);\n", source_override ? source_override : "src", type_names[op->type], masks);
+	}
+	emit_return(op, 0);
+}
+
+static void emit_alu16(const Operation* op) {
+	char masks[32];
+	masks_arg(op, masks);
+	out("\tu16 dst = r->%s;\n", reg16(op->dest));
+	emit_source16(op);
+	out("\talu16_return ret = alu16(&emu->cpu, dst, src, %s, %s, %s);\n", type_names[op->type], addr_mode_names[op->source_addr_mode], masks);
+	out("\tr->%s = ret.result;\n", reg16(op->dest));
+	out("\twrite_flags(&emu->cpu, ret.flags);\n");
+	emit_return(op, 0);
+}
+
+static void emit_inc_dec(const Operation* op) {
+	char masks[32];
+	masks_arg(op, masks);
+	switch (op->dest_addr_mode) {
+	case REGISTER:
+		out("\tr->%s = alu8_update(&emu->cpu, r->%s, 1, %s, %s);\n", reg8(op->dest), reg8(op->dest), type_names[op->type], masks);
+		break;
+	case REGISTER16:
+		out("\t%sr->%s;\n", op->type == INC ? "++" : "--", reg16(op->dest));
+		break;
+	case ADDRESS_R16:
+		out("\tu8 prev = read8(emu, r->%s);\n", reg16(op->dest));
+		out("\twrite8(emu, r->%s, alu8_update(&emu->cpu, prev, 1, %s, %s));\n", reg16(op->dest), type_names[op->type], masks);
+		break;
+	default:
+		break;
+	}
+	emit_return(op, 0);
+}
+
+static void emit_jp(const Operation* op) {
+	const char* cond = condition_expr(op->condition);
+	if (bit_mode_16(op)) {
+		emit_source16(op);
+		if (cond) {
+			out("\tif (%s) {\n", cond);
+			out("\t\tr->pc = src;\n");
+			out("\t\treturn (Cycles) { %d, %d };\n", op->m_cycles, op->t_cycles + secondary_cycles(op));
+			out("\t}\n");
+			emit_return(op, 0);
+		}
+		else {
+			out("\tr->pc = src;\n");
+			emit_return(op, secondary_cycles(op));
+		}
+		return;
+	}
+	out("\tu8 relative = (u8)operand;\n");
+	out("\tu16 jump_to = r->pc + (i8)relative;\n");
+	if (cond) {
+		out("\tif (%s) {\n", cond);
+		out("\t\tr->pc = jump_to;\n");
+		out("\t\treturn (Cycles) { %d, %d };\n", op->m_cycles, op->t_cycles + secondary_cycles(op));
+		out("\t}\n");
+		emit_return(op, 0);
+	}
+	else {
+		out("\tr->pc = jump_to;\n");
+		emit_return(op, secondary_cycles(op));
+	}
+}
+
+static void emit_call(const Operation* op) {
+	const char* cond = condition_expr(op->condition);
+	emit_source16(op);
+	if (cond) {
+		out("\tif (%s) {\n", cond);
+		out("\t\twrite16(emu, r->sp - 2, r->pc);\n");
+		out("\t\tr->sp -= 2;\n");
+		out("\t\tr->pc = src;\n");
+		out("\t\tsampler_call(emu);\n");
+		out("\t}\n");
+	}
+	else {
+		out("\twrite16(emu, r->sp - 2, r->pc);\n");
+		out("\tr->sp -= 2;\n");
+		out("\tr->pc = src;\n");
+		out("\tsampler_call(emu);\n");
+	}
+	// CALL_impl charges its secondary whether or not the call is taken
+	emit_return(op, secondary_cycles(op));
+}
+
+static void emit_ret(const Operation* op) {
+	const char* cond = condition_expr(op->condition);
+	if (cond) {
+		out("\tif (%s) {\n", cond);
+		out("\t\tr->pc = read16(emu, r->sp);\n");
+		out("\t\tr->sp += 2;\n");
+		out("\t\tsampler_return(emu);\n");
+		out("\t\treturn (Cycles) { %d, %d };\n", op->m_cycles, op->t_cycles + secondary_cycles(op));
+		out("\t}\n");
+		emit_return(op, 0);
+	}
+	else {
+		out("\tr->pc = read16(emu, r->sp);\n");
+		out("\tr->sp += 2;\n");
+		out("\tsampler_return(emu);\n");
+		if (op->type == RETI) {
+			out("\tupdate_IME(&emu->cpu, true);\n");
+		}
+		emit_return(op, secondary_cycles(op));
+	}
+}
+
+static void emit_handler(const Operation* op, bool cb) {
+	body_len = 0;
+	body[0] = '\0';
+
+	switch (op->type) {
+	case HALT:
+		out("\temu->cpu.halted = true;\n");
+		emit_return(op, 0);
+		break;
+	case LD:
+		emit_ld(op);
+		break;
+	case INC:
+	case DEC:
+		emit_inc_dec(op);
+		break;
+	case BIT: {
+		char test[8];
+		sprintf(test, "0x%02X", 1 << op->dest);
+		char masks[32];
+		masks_arg(op, masks);
+		emit_source8(op);
+		out("\talu8_update(&emu->cpu, src, %s, BIT, %s);\n", test, masks);
+		emit_return(op, 0);
+		break;
+	}
+	case CP:
+		emit_alu8(op, false, NULL);
+		break;
+	case XOR:
+	case ADD:
+	case ADC:
+	case SUB:
+	case SBC:
+	case SET_OP:
+	case OR:
+	case AND:
+	case CPL:
+	case RES:
+	case SLA:
+	case SRL:
+	case SRA:
+	case RR:
+	case RLC:
+	case RRC:
+	case SCF:
+	case CCF:
+		if (op->type != XOR && bit_mode_16(op)) {
+			emit_alu16(op);
+		}
+		else {
+			emit_alu8(op, true, NULL);
+		}
+		break;
+	case RLA:
+	case RL:
+	case SWAP:
+		emit_alu8(op, true, "0");
+		break;
+	case JP:
+		emit_jp(op);
+		break;
+	case CALL:
+		emit_call(op);
+		break;
+	case RET:
+	case RETI:
+		emit_ret(op);
+		break;
+	case RST:
+		out("\twrite16(emu, r->sp - 2, r->pc);\n");
+		out("\tr->sp -= 2;\n");
+		out("\tr->pc = 0x%04X;\n", op->dest);
+		out("\tsampler_call(emu);\n");
+		emit_return(op, 0);
+		break;
+	case PUSH:
+		if (op->source == AF) {
+			out("\tresolve_flags(&emu->cpu);\n");
+		}
+		out("\twrite16(emu, r->sp - 2, r->%s);\n", reg16(op->source));
+		out("\tr->sp -= 2;\n");
+		emit_return(op, 0);
+		break;
+	case POP:
+		out("\tr->%s = read16(emu, r->sp);\n", reg16(op->dest));
+		if (op->dest == AF) {
+			out("\twrite_flags(&emu->cpu, r->f & 0xF0);\n");
+		}
+		out("\tr->sp += 2;\n");
+		emit_return(op, 0);
+		break;
+	case CB:
+		out("\tCycles c = fast_cb_handlers[(u8)operand](emu, 0);\n");
+		if (op->m_cycles || op->t_cycles) {
+			out("\tc.m_cycles += %d;\n", op->m_cycles);
+			out("\tc.t_cycles += %d;\n", op->t_cycles);
+		}
+		out("\treturn c;\n");
+		break;
+	case EI:
+		out("\tupdate_IME(&emu->cpu, true);\n");
+		emit_return(op, 0);
+		break;
+	case DI:
+		out("\tupdate_IME(&emu->cpu, false);\n");
+		emit_return(op, 0);
+		break;
+	case DAA:
+		out("\tdaa(&emu->cpu);\n");
+		emit_return(op, 0);
+		break;
+	default: // NOP, STOP and unimplemented opcodes
+		emit_return(op, 0);
+		break;
+	}
+
+	const char* mnemonic = cb ? cb_operation_mnemonics[op->opcode] : operation_mnemonics[op->opcode];
+	printf("static Cycles %s_%02X(Emulator* emu, u16 operand) { // %s\n", cb ? "cb" : "op", op->opcode, mnemonic ? mnemonic : "unimplemented");
+	if (strstr(body, "r->")) {
+		printf("\tRegisters* r = &emu->cpu.registers;\n");
+	}
+	printf("%s}\n\n", body);
+}
+
+#define MAX_FUSED_OPS 3
+
+// Copy loops, LDH/CP compares and DEC/JR delay loops. Longer patterns first, since the decoder takes the
+// first match. Only the last op of a pattern may jump; EI, DI, HALT and CB ops aren't fused.
+static const u8 fusion_patterns[][MAX_FUSED_OPS + 1] = { // length, opcodes
+	{ 3, 0x2A, 0x12, 0x13 }, // LD A, (HL+) / LD (DE), A / INC DE
+	{ 3, 0x1A, 0x22, 0x13 }, // LD A, (DE) / LD (HL+), A / INC DE
+	{ 3, 0xF0, 0xFE, 0x20 }, // LDH A, (u8) / CP u8 / JR NZ
+	{ 3, 0xF0, 0xFE, 0x28 },
+	{ 3, 0xF0, 0xFE, 0x30 },
+	{ 3, 0xF0, 0xFE, 0x38 },
+	{ 3, 0x78, 0xB1, 0x20 }, // LD A, B / OR C / JR NZ
+	{ 2, 0xF0, 0xFE },
+	{ 2, 0xF0, 0xE6 }, // LDH A, (u8) / AND u8
+	{ 2, 0xFE, 0x20 },
+	{ 2, 0xFE, 0x28 },
+	{ 2, 0xA7, 0x20 },
+	{ 2, 0xA7, 0x28 },
+	{ 2, 0x22, 0x0B }, // LD (HL+), A / DEC BC
+	{ 2, 0x0B, 0x78 }, // DEC BC / LD A, B
+	{ 2, 0x05, 0x20 }, // DEC r / JR NZ
+	{ 2, 0x0D, 0x20 },
+	{ 2, 0x15, 0x20 },
+	{ 2, 0x1D, 0x20 },
+	{ 2, 0x25, 0x20 },
+	{ 2, 0x2D, 0x20 },
+	{ 2, 0x3D, 0x20 },
+};
+#define NUM_FUSION_PATTERNS (int)(sizeof(fusion_patterns) / sizeof(fusion_patterns[0]))
+
+static void fusion_name(char* name, const u8* pattern) {
+	name += sprintf(name, "fused");
+	for (int i = 1; i <= pattern[0]; ++i) {
+		name += sprintf(name, "_%02X", pattern[i]);
+	}
+}
+
+// Runs the ops back to back with the single-op handlers inlined. continue_fusion does what step() would have
+// done in between, or ends the group early; the last op's cycles go back to the caller like a single op's.
+static void emit_fused_handler(const u8* pattern) {
+	char name[32];
+	fusion_name(name, pattern);
+	printf("static Cycles %s(Emulator* emu, const MicroOp* ops) { //", name);
+	for (int i = 1; i <= pattern[0]; ++i) {
+		printf("%s %s", i > 1 ? " /" : "", operation_mnemonics[pattern[i]]);
+	}
+	printf("\n\tCycles c = op_%02X(emu, ops[0].operand);\n", pattern[1]);
+	for (int i = 2; i <= pattern[0]; ++i) {
+		printf("\tif (!continue_fusion(emu, &ops[%d], &c)) {\n\t\treturn c;\n\t}\n", i - 1);
+		printf("\t%sop_%02X(emu, ops[%d].operand);\n", i < pattern[0] ? "c = " : "return ", pattern[i], i - 1);
+	}
+	printf("}\n\n");
+}
+
+static void emit_fusion_table() {
+	printf("const Fusion fusions[] = {\n");
+	for (int i = 0; i < NUM_FUSION_PATTERNS; ++i) {
+		const u8* pattern = fusion_patterns[i];
+		char name[32];
+		fusion_name(name, pattern);
+		printf("\t{ %d, {", pattern[0]);
+		for (int j = 1; j <= pattern[0]; ++j) {
+			printf("%s 0x%02X", j > 1 ? "," : "", pattern[j]);
+		}
+		printf(" }, %s, \"", name);
+		for (int j = 1; j <= pattern[0]; ++j) {
+			printf("%s%s", j > 1 ? " / " : "", operation_mnemonics[pattern[j]]);
+		}
+		printf("\" },\n");
+	}
+	printf("};\n");
+	printf("const int num_fusions = %d;\n", NUM_FUSION_PATTERNS);
+}
+
+static int immediate_bytes(address_mode mode) {
+	switch (mode) {
+	case MEM_READ:
+	case MEM_READ_ADDR_OFFSET:
+		return 1;
+	case MEM_READ16:
+	case MEM_READ_ADDR:
+		return 2;
+	default:
+		return 0;
+	}
+}
+
+// opcode byte plus immediates; the CB prefix's dest MEM_READ covers its second byte
+static int instruction_length(const Operation* op) {
+	int length = 1 + immediate_bytes(op->dest_addr_mode) + immediate_bytes(op->source_addr_mode);
+	if (op->source == SP_ADD_I8) ++length;
+	return length;
+}
+
+static void emit_length_table() {
+	printf("const u8 instruction_lengths[0x100] = {\n");
+	for (int i = 0; i < 0x100; ++i) {
+		printf("%s%d,%s", (i % 16 == 0) ? "\t" : "", instruction_length(&operations[i]), (i % 16 == 15) ? "\n" : " ");
+	}
+	printf("};\n");
+}
+
+static void emit_table(const char* name, const char* prefix) {
+	printf("const fast_handler %s[0x100] = {\n", name);
+	for (int i = 0; i < 0x100; ++i) {
+		printf("%s%s_%02X,%s", (i % 8 == 0) ? "\t" : "", prefix, i, (i % 8 == 7) ? "\n" : " ");
+	}
+	printf("};\n");
+}
+
+int main() {
+	printf("// Generated by tools/gen_handlers.c from cpu/operations.c. Do not edit by hand.\n\n");
+	printf("#include \"handlers.h\"\n");
+	printf("#include \"alu.h\"\n");
+	printf("#include \"cpu.h\"\n");
+	printf("#include \"block_cache.h\"\n");
+	printf("#include \"native.h\"\n");
+	printf("#include \"sampler.h\"\n\n");
+
+	for (int i = 0; i < 0x100; ++i) {
+		Operation op = operations[i];
+		op.opcode = i;
+		emit_handler(&op, false);
+	}
+	for (int i = 0; i < 0x100; ++i) {
+		Operation op = cb_operations[i];
+		op.opcode = i;
+		emit_handler(&op, true);
+	}
+
+	for (int i = 0; i < NUM_FUSION_PATTERNS; ++i) {
+		emit_fused_handler(fusion_patterns[i]);
+	}
+
+	emit_table("fast_handlers", "op");
+	printf("\n");
+	emit_table("fast_cb_handlers", "cb");
+	printf("\n");
+	emit_length_table();
+	printf("\n");
+	emit_fusion_table();
+	return 0;
+}
@@ -0,0 +1,322 @@
+// Runs a ROM on two emulators in lockstep, the reference switch interpreter and an engine under test, and
+// stops at the first point where they disagree. From the repository root:
+//
+//   cc -O2 -o lockstep tools/lockstep.c $(find . -name '*.c' ! -path './tools/*') -ldl -lpthread
+//   ./lockstep game.gb [options]
+//
+//   -e mode     dispatch mode under test (DispatchMode number, default DISPATCH_BLOCK_CACHE)
+//   -r mode     reference dispatch mode (default DISPATCH_SWITCH)
+//   -s          spin-loop skipping on for the engine under test
+//   -f frames   frames of emulated time to run (default 3600)
+//   -g cycles   full comparison every this many t-cycles, 0 for every instruction boundary (default 70224)
+//   -w records  trace records shown around a divergence (default 24)
+//   -i seed     input seed, the buttons change every few frames; 0 for no input (default 1)
+//
+// The emulators only step one at a time, always the one that is behind (at a tie, the one that hasn't
+// stepped since the last comparison), and are compared whenever their clocks meet after both have stepped:
+// a JIT block, fused group or fast-forward lands on a clock the reference reaches one instruction at a time
+// if both agree. The CPU state is compared every time; memory, timer, PPU, APU and the framebuffer at the
+// -g granularity. Input changes are applied to both at the same clock.
+//
+// Build the tool with the same options or flavor as the core under test; YOLAHBOY_FAST works too. The
+// reference switch interpreter doesn't use lazy flags, ALU tables or fusion whatever the build (its ALU is
+// alu8_compute, with flags worked out eagerly), so those are checked against unoptimized code in the same
+// binary.
+//
+// Where the core has tracing (cpu/trace.h) the reference is traced, and so is the engine unless it runs
+// native JIT or AOT code, which tracing would turn off. With both traced the first differing record is
+// found and shown next to its counterpart; otherwise the reference's last records before the divergence
+// are shown. Without tracing, as in the fast flavor, only the two states at the divergence are.
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../yolahboy.h"
+
+#define FRAME_CYCLES 70224
+#define TRACE_RECORDS (1 << 20)
+#define MAX_DRIFT (4 * FRAME_CYCLES) // clocks this far apart without meeting count as a divergence
+#define INPUT_FRAMES 5
+
+typedef struct {
+	Emulator* emu;
+	const char* name;
+	bool traced;
+} Side;
+
+static char difference[256];
+
+static bool differ(const char* what) {
+	snprintf(difference, sizeof(difference), "%s", what);
+	return true;
+}
+
+static bool compare_cpu(Emulator* a, Emulator* b) {
+	sync_flags(&a->cpu);
+	sync_flags(&b->cpu);
+	if (memcmp(&a->cpu.registers, &b->cpu.registers, sizeof(Registers)) != 0) return differ("registers");
+	if (a->cpu.IME != b->cpu.IME || a->cpu.should_update_IME != b->cpu.should_update_IME) return differ("IME");
+	if (a->cpu.halted != b->cpu.halted) return differ("halted");
+	if (a->cpu.pending_interrupts != b->cpu.pending_interrupts) return differ("pending interrupts");
+	return false;
+}
+
+static bool compare_all(Emulator* a, Emulator* b) {
+	for (int address = 0; address < 0x10000; ++address) {
+		if (a->mmu.memory[address] != b->mmu.memory[address]) {
+			snprintf(difference, sizeof(difference), "memory at %04X: %02X vs %02X", address,
+				a->mmu.memory[address], b->mmu.memory[address]);
+			return true;
+		}
+	}
+	Cartridge* ca = &a->mmu.cartridge;
+	Cartridge* cb = &b->mmu.cartridge;
+	if (ca->rom_bank != cb->rom_bank || ca->ram_bank != cb->ram_bank || ca->ram_enabled != cb->ram_enabled
+		|| ca->banking_mode != cb->banking_mode) return differ("cartridge banking");
+	if (ca->ram != NULL && cb->ram != NULL && memcmp(ca->ram, cb->ram, ca->ram_size) != 0) return differ("cartridge RAM");
+
+	if (a->timer.clock != b->timer.clock || a->timer.mode != b->timer.mode || a->timer.old_and != b->timer.old_and) return differ("timer");
+
+	Gpu* ga = &a->gpu;
+	Gpu* gb = &b->gpu;
+	if (ga->clock != gb->clock || ga->mode != gb->mode || ga->ly != gb->ly || ga->stat != gb->stat
+		|| ga->lcdc != gb->lcdc || ga->should_stat_interrupt != gb->should_stat_interrupt) return differ("PPU");
+	if (memcmp(ga->framebuffer, gb->framebuffer, SCREEN_WIDTH * SCREEN_HEIGHT * sizeof(u32)) != 0) return differ("framebuffer");
+
+	Apu* aa = &a->apu;
+	Apu* ab = &b->apu;
+	if (memcmp(&aa->nr52, &ab->nr52, offsetof(Apu, buffer_full) - offsetof(Apu, nr52)) != 0) return differ("APU registers");
+	if (aa->clock != ab->clock || aa->div_apu_internal != ab->div_apu_internal || aa->div_apu_counter != ab->div_apu_counter
+		|| aa->sweep_timer != ab->sweep_timer || aa->sweep_freq_shadow != ab->sweep_freq_shadow || aa->lfsr != ab->lfsr
+		|| aa->sample_counter != ab->sample_counter || aa->buffer_position != ab->buffer_position) return differ("APU state");
+	if (memcmp(aa->channel, ab->channel, sizeof(aa->channel)) != 0) return differ("APU channels");
+	if (memcmp(aa->buffer, ab->buffer, aa->buffer_position * 2 * sizeof(float)) != 0) return differ("audio samples");
+	return false;
+}
+
+static void print_state(const Side* side) {
+	Emulator* emu = side->emu;
+	Registers* r = &emu->cpu.registers;
+	printf("  %-10s clock %llu  PC=%04X AF=%04X BC=%04X DE=%04X HL=%04X SP=%04X IME=%d halted=%d IF=%02X IE=%02X LY=%d\n",
+		side->name, emu->clock, r->pc, r->af, r->bc, r->de, r->hl, r->sp, emu->cpu.IME, emu->cpu.halted,
+		emu->mmu.memory[IF], emu->mmu.memory[IE], emu->gpu.ly);
+}
+
+static void print_record(const char* prefix, const TraceRecord* record) {
+	const Registers* r = &record->registers;
+	switch (record->kind) {
+	case TRACE_INSTRUCTION: {
+		u8 opcode = record->value;
+		const char* mnemonic = operations[opcode].type == CB ? cb_operation_mnemonics[record->operand & 0xFF] : operation_mnemonics[opcode];
+		printf("%s%12llu  %04X  %02X %04X %-18s AF=%04X BC=%04X DE=%04X HL=%04X SP=%04X\n", prefix, record->clock, r->pc,
+			opcode, record->operand, mnemonic ? mnemonic : "unimplemented", r->af, r->bc, r->de, r->hl, r->sp);
+		break;
+	}
+	case TRACE_INTERRUPT:
+		printf("%s%12llu  %04X  interrupt %04X\n", prefix, record->clock, r->pc, record->operand);
+		break;
+	default:
+		printf("%s%12llu  %04X    [%04X] <- %02X\n", prefix, record->clock, r->pc, record->operand, record->value);
+		break;
+	}
+}
+
+static bool same_record(const TraceRecord* a, const TraceRecord* b) {
+	if (a->clock != b->clock || a->kind != b->kind || a->value != b->value || a->operand != b->operand) {
+		return false;
+	}
+	if (a->kind == TRACE_WRITE) {
+		return true;
+	}
+	// F can lag behind in either with ENABLE_LAZY_FLAGS, so it's left out
+	return a->registers.pc == b->registers.pc && a->registers.a == b->registers.a && a->registers.bc == b->registers.bc
+		&& a->registers.de == b->registers.de && a->registers.hl == b->registers.hl && a->registers.sp == b->registers.sp;
+}
+
+// The records after since, in both traces if both are traced, and where they first differ.
+static void report_trace(Side* ref, Side* test, unsigned long long since, int window) {
+	static TraceRecord ref_records[TRACE_RECORDS];
+	static TraceRecord test_records[TRACE_RECORDS];
+	if (!ref->traced) {
+		printf("no trace, the core was built without ENABLE_TRACE\n");
+		return;
+	}
+	int num_ref = read_trace(ref->emu, ref_records, TRACE_RECORDS);
+	int first_ref = 0;
+	while (first_ref < num_ref && ref_records[first_ref].clock < since) ++first_ref;
+
+	if (!test->traced) {
+		printf("last %s records (%s isn't traced):\n", ref->name, test->name);
+		for (int i = num_ref - window > 0 ? num_ref - window : 0; i < num_ref; ++i) {
+			print_record("  ", &ref_records[i]);
+		}
+		return;
+	}
+
+	int num_test = read_trace(test->emu, test_records, TRACE_RECORDS);
+	int first_test = 0;
+	while (first_test < num_test && test_records[first_test].clock < since) ++first_test;
+
+	int i = 0;
+	while (first_ref + i < num_ref && first_test + i < num_test && same_record(&ref_records[first_ref + i], &test_records[first_test + i])) {
+		++i;
+	}
+	if (first_ref + i >= num_ref || first_test + i >= num_test) {
+		printf("traces agree up to the divergence; last records:\n");
+	}
+	else {
+		printf("first differing record:\n");
+		print_record("  ref  ", &ref_records[first_ref + i]);
+		print_record("  test ", &test_records[first_test + i]);
+		printf("records around it:\n");
+	}
+	int from = i - window / 2 > -first_ref ? i - window / 2 : -first_ref;
+	for (int j = from; j < from + window; ++j) {
+		if (first_ref + j < num_ref) print_record(j == i ? "> ref  " : "  ref  ", &ref_records[first_ref + j]);
+		if (first_test + j >= 0 && first_test + j < num_test) print_record(j == i ? "> test " : "  test ", &test_records[first_test + j]);
+	}
+}
+
+// Traces the emulator if traced is set and the core can; traced says whether it is on return.
+static Emulator* create(const char* rom, int mode, bool spin, bool* traced) {
+	Emulator* emu = (Emulator*)calloc(1, sizeof(Emulator));
+	if (emu == NULL || init_emulator(emu, 44100, 1024) != 0 || load_emu_rom(emu, rom, false) != 0) {
+		fprintf(stderr, "can't load %s\n", rom);
+		exit(1);
+	}
+	skip_bootrom(emu);
+	set_dispatch_mode(emu, (DispatchMode)mode);
+	set_spin_loop_skip(emu, spin);
+	if (*traced && start_trace(emu, TRACE_RECORDS) != 0) {
+		*traced = false;
+	}
+	return emu;
+}
+
+static Controller random_input(unsigned* seed) {
+	*seed = *seed * 1103515245 + 12345;
+	unsigned bits = *seed >> 16;
+	Controller controller;
+	memset(&controller, 0, sizeof(Controller));
+	controller.up = bits & 1;
+	controller.down = !controller.up && (bits & 2);
+	controller.left = bits & 4;
+	controller.right = !controller.left && (bits & 8);
+	controller.a = bits & 16;
+	controller.b = bits & 32;
+	controller.start = (bits & 0x3C0) == 0x3C0;
+	controller.select = (bits & 0x3C00) == 0x3C00;
+	return controller;
+}
+
+int main(int argc, char** argv) {
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s rom.gb [-e mode] [-r mode] [-s] [-f frames] [-g cycles] [-w records] [-i seed]\n", argv[0]);
+		return 1;
+	}
+	int test_mode = DISPATCH_BLOCK_CACHE;
+	int ref_mode = DISPATCH_SWITCH;
+	bool spin = false;
+	long long frames = 3600;
+	long long granularity = FRAME_CYCLES;
+	int window = 24;
+	unsigned seed = 1;
+	for (int i = 2; i < argc; ++i) {
+		const char* value = i + 1 < argc ? argv[i + 1] : "0";
+		if (!strcmp(argv[i], "-s")) { spin = true; continue; }
+		else if (!strcmp(argv[i], "-e")) test_mode = atoi(value);
+		else if (!strcmp(argv[i], "-r")) ref_mode = atoi(value);
+		else if (!strcmp(argv[i], "-f")) frames = atoll(value);
+		else if (!strcmp(argv[i], "-g")) granularity = atoll(value);
+		else if (!strcmp(argv[i], "-w")) window = atoi(value);
+		else if (!strcmp(argv[i], "-i")) seed = (unsigned)atoi(value);
+		else { fprintf(stderr, "unknown option %s\n", argv[i]); return 1; }
+		++i;
+	}
+
+	bool ref_traced = true;
+	bool test_traced = test_mode != DISPATCH_JIT && test_mode != DISPATCH_AOT;
+	Emulator* ref_emu = create(argv[1], ref_mode, false, &ref_traced);
+	Emulator* test_emu = create(argv[1], test_mode, spin, &test_traced);
+	Side ref = { ref_emu, "reference", ref_traced };
+	Side test = { test_emu, "test", test_traced };
+	bool has_input = seed != 0;
+
+	unsigned long long end = (unsigned long long)frames * FRAME_CYCLES;
+	unsigned long long last_match = 0;
+	unsigned long long next_full = granularity;
+	unsigned long long next_input = INPUT_FRAMES * FRAME_CYCLES;
+	unsigned long long comparisons = 0;
+	const char* failure = NULL;
+
+	// whether each side has stepped since the last comparison; a 0-cycle step (an unimplemented opcode) leaves
+	// the clocks tied with the other side still an instruction behind
+	bool ref_stepped = false;
+	bool test_stepped = false;
+	while (ref.emu->clock < end && failure == NULL) {
+		Emulator* behind;
+		if (ref.emu->clock != test.emu->clock) {
+			behind = ref.emu->clock < test.emu->clock ? ref.emu : test.emu;
+		}
+		else {
+			behind = ref_stepped ? test.emu : ref.emu;
+		}
+		if (step(behind) < 0) {
+			failure = behind == ref.emu ? "the reference stopped on an unimplemented instruction" : "the engine stopped on an unimplemented instruction";
+			break;
+		}
+		if (behind == ref.emu) {
+			ref_stepped = true;
+		}
+		else {
+			test_stepped = true;
+		}
+
+		unsigned long long ref_clock = ref.emu->clock;
+		unsigned long long test_clock = test.emu->clock;
+		if (ref_clock != test_clock) {
+			if (ref_clock > test_clock + MAX_DRIFT || test_clock > ref_clock + MAX_DRIFT) {
+				snprintf(difference, sizeof(difference), "clocks drifted apart without meeting");
+				failure = difference;
+			}
+			continue;
+		}
+		if (!ref_stepped || !test_stepped) {
+			continue;
+		}
+		ref_stepped = false;
+		test_stepped = false;
+
+		++comparisons;
+		if (compare_cpu(ref.emu, test.emu)) {
+			failure = difference;
+		}
+		else if (ref_clock >= next_full) {
+			if (compare_all(ref.emu, test.emu)) {
+				failure = difference;
+			}
+			next_full = granularity ? (ref_clock / granularity + 1) * granularity : ref_clock + 1;
+		}
+		if (failure == NULL) {
+			last_match = ref_clock;
+			if (has_input && ref_clock >= next_input) {
+				Controller controller = random_input(&seed);
+				update_emu_controller(ref.emu, controller);
+				update_emu_controller(test.emu, controller);
+				next_input = ref_clock + INPUT_FRAMES * FRAME_CYCLES;
+			}
+		}
+	}
+
+	if (failure == NULL) {
+		printf("no divergence: dispatch %d%s against %d for %llu frames, %llu comparisons\n", test_mode,
+			spin ? " with spin skip" : "", ref_mode, (unsigned long long)frames, comparisons);
+		return 0;
+	}
+	printf("DIVERGED: %s\n  last agreement at clock %llu\n", failure, last_match);
+	print_state(&ref);
+	print_state(&test);
+	report_trace(&ref, &test, last_match, window);
+	return 2;
+}
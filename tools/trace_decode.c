@@ -0,0 +1,98 @@
+// Prints a trace written by dump_trace (see cpu/trace.h), one line per record, with instructions
+// disassembled from the operations table. From the repository root:
+//
+//   cc -o trace_decode tools/trace_decode.c cpu/operations.c
+//   ./trace_decode trace.bin [last]
+//
+// With last, only that many records from the end are printed.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../cpu/trace.h"
+#include "../cpu/operation_definitions.h"
+
+// The mnemonic with its u8/i8/u16 placeholder replaced by the operand.
+static void disassemble(const TraceRecord* record, char* out, size_t size) {
+	const char* mnemonic = operations[record->value].type == CB ? cb_operation_mnemonics[record->operand & 0xFF]
+		: operation_mnemonics[record->value];
+	if (mnemonic == NULL) {
+		mnemonic = "unimplemented";
+	}
+
+	const char* placeholder = NULL;
+	char value[8] = "";
+	if ((placeholder = strstr(mnemonic, "u16")) != NULL) {
+		sprintf(value, "%04X", record->operand);
+	}
+	else if ((placeholder = strstr(mnemonic, "u8")) != NULL) {
+		sprintf(value, "%02X", record->operand & 0xFF);
+	}
+	else if ((placeholder = strstr(mnemonic, "i8")) != NULL) {
+		sprintf(value, "%+d", (signed char)record->operand);
+	}
+	if (placeholder == NULL) {
+		snprintf(out, size, "%s", mnemonic);
+		return;
+	}
+	int prefix = (int)(placeholder - mnemonic);
+	int length = placeholder[0] == 'u' && placeholder[1] == '1' ? 3 : 2;
+	snprintf(out, size, "%.*s%s%s", prefix, mnemonic, value, placeholder + length);
+}
+
+static void print_record(const TraceRecord* record) {
+	const Registers* r = &record->registers;
+	switch (record->kind) {
+	case TRACE_INSTRUCTION: {
+		char text[64];
+		disassemble(record, text, sizeof(text));
+		printf("%14llu  %04X  %-20s AF=%04X BC=%04X DE=%04X HL=%04X SP=%04X\n",
+			record->clock, r->pc, text, r->af, r->bc, r->de, r->hl, r->sp);
+		break;
+	}
+	case TRACE_INTERRUPT:
+		printf("%14llu  %04X  interrupt %04X       SP=%04X\n", record->clock, r->pc, record->operand, r->sp);
+		break;
+	case TRACE_WRITE:
+		printf("%14llu  %04X    [%04X] <- %02X\n", record->clock, r->pc, record->operand, record->value);
+		break;
+	default:
+		printf("%14llu  unknown record kind %d\n", record->clock, record->kind);
+		break;
+	}
+}
+
+int main(int argc, char** argv) {
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s trace.bin [last]\n", argv[0]);
+		return 1;
+	}
+	FILE* file = fopen(argv[1], "rb");
+	if (file == NULL) {
+		fprintf(stderr, "can't open %s\n", argv[1]);
+		return 1;
+	}
+	TraceHeader header;
+	if (fread(&header, sizeof(header), 1, file) != 1 || memcmp(header.magic, TRACE_MAGIC, 4) != 0) {
+		fprintf(stderr, "%s isn't a trace\n", argv[1]);
+		return 1;
+	}
+	if (header.version != TRACE_VERSION || header.record_size != sizeof(TraceRecord)) {
+		fprintf(stderr, "trace version %u with %u byte records, this build reads version %d with %d\n",
+			header.version, header.record_size, TRACE_VERSION, (int)sizeof(TraceRecord));
+		return 1;
+	}
+
+	u32 skip = 0;
+	if (argc > 2 && (u32)atoi(argv[2]) < header.count) {
+		skip = header.count - atoi(argv[2]);
+	}
+	TraceRecord record;
+	for (u32 i = 0; i < header.count && fread(&record, sizeof(record), 1, file) == 1; ++i) {
+		if (i >= skip) {
+			print_record(&record);
+		}
+	}
+	fclose(file);
+	return 0;
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+// Everything a frontend uses, for every flavor (see build_config.h). Calls into features a flavor was built
+// without still link and report that they're unavailable.
+
+#include "global_definitions.h"
+#include "emulator.h"
+#include "mmu/mmu.h"
+#include "cpu/cpu.h"
+#include "cpu/block_cache.h"
+#include "cpu/profiler.h"
+#include "cpu/sampler.h"
+#include "cpu/trace.h"
+#include "mmu/rom_store.h"